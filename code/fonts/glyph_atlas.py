@@ -0,0 +1,99 @@
+#!/usr/bin/env python3
+"""
+Packs selected glyphs of a BDF font into a C header that the renderer blits without decoding.
+
+Each glyph is stored row by row, every row as ceil(width / 8) bytes with the leftmost pixel in the
+lowest bit. With the display rotated by U8G2_R1, a byte of the SH1107 buffer holds eight horizontally
+adjacent screen pixels in the same order, so glyph bytes can be shifted and or-ed straight into it.
+
+usage: glyph_atlas.py <font.bdf> <name> <characters> <output.h>
+"""
+
+import sys
+
+
+def parse_bdf(path):
+    glyphs = {}
+    properties = {}
+    with open(path) as file:
+        lines = iter(file.read().splitlines())
+    for line in lines:
+        parts = line.split()
+        if not parts:
+            continue
+        if parts[0] in ("FONT_ASCENT", "FONT_DESCENT"):
+            properties[parts[0]] = int(parts[1])
+        if parts[0] != "STARTCHAR":
+            continue
+
+        glyph = {}
+        for line in lines:
+            parts = line.split()
+            if parts[0] == "ENCODING":
+                glyph["encoding"] = int(parts[1])
+            elif parts[0] == "DWIDTH":
+                glyph["advance"] = int(parts[1])
+            elif parts[0] == "BBX":
+                glyph["width"], glyph["height"], glyph["x"], glyph["y"] = map(int, parts[1:5])
+            elif parts[0] == "BITMAP":
+                glyph["rows"] = []
+                for _ in range(glyph["height"]):
+                    glyph["rows"].append(int(next(lines), 16) if glyph["width"] > 0 else 0)
+            elif parts[0] == "ENDCHAR":
+                break
+        glyphs[glyph["encoding"]] = glyph
+    return glyphs, properties
+
+
+def pack_row(value, width):
+    """BDF rows are left aligned in whole bytes with the leftmost pixel in the highest bit."""
+    row_bytes = (width + 7) // 8
+    bits = row_bytes * 8
+    packed = []
+    for b in range(row_bytes):
+        byte = 0
+        for i in range(8):
+            pixel = 8 * b + i
+            if pixel < width and value & (1 << (bits - 1 - pixel)):
+                byte |= 1 << i
+        packed.append(byte)
+    return packed
+
+
+def main():
+    if len(sys.argv) != 5:
+        sys.exit(__doc__.strip().splitlines()[-1])
+    path, name, characters, output = sys.argv[1:]
+    glyphs, properties = parse_bdf(path)
+
+    entries = []
+    bits = []
+    for character in sorted(set(characters)):
+        glyph = glyphs.get(ord(character))
+        if glyph is None:
+            sys.exit("glyph '%s' missing in %s" % (character, path))
+        offset = len(bits)
+        for row in glyph["rows"]:
+            bits.extend(pack_row(row, glyph["width"]))
+        # top row relative to the baseline, like u8g2 places glyphs
+        top = -(glyph["height"] + glyph["y"])
+        entries.append((character, glyph["advance"], glyph["width"], glyph["height"], glyph["x"], top, offset))
+
+    with open(output, "w") as out:
+        out.write("/*\n  Generated by fonts/glyph_atlas.py from %s, do not edit.\n" % path.replace("\\", "/"))
+        out.write("  Characters: %s\n*/\n" % "".join(entry[0] for entry in entries))
+        out.write("#pragma once\n\n#include \"glyph_atlas.h\"\n\n")
+        out.write("static const uint8_t %s_bits[%d] = {\n" % (name, len(bits)))
+        for i in range(0, len(bits), 16):
+            out.write("    " + " ".join("0x%02x," % b for b in bits[i:i + 16]) + "\n")
+        out.write("};\n\n")
+        out.write("static const AtlasGlyph %s_glyphs[%d] = {\n" % (name, len(entries)))
+        for character, advance, width, height, x, top, offset in entries:
+            out.write("    {'%s', %d, %d, %d, %d, %d, %d},\n" % ("\\'" if character == "'" else character, advance, width, height, x, top, offset))
+        out.write("};\n\n")
+        out.write("static const GlyphAtlas %s = {%s_glyphs, %d, %s_bits, %d, %d};" % (
+            name, name, len(entries), name, properties["FONT_ASCENT"], properties["FONT_DESCENT"]))
+
+
+if __name__ == "__main__":
+    main()
\ No newline at end of file
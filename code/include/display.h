@@ -5,9 +5,31 @@
 
 namespace Display
 {
+    struct FrameCounters
+    {
+        uint32_t pushed;
+        /// frames not drawn because nothing visible changed
+        uint32_t skipped;
+        /// display data bytes sent for the last pushed frame
+        uint16_t lastFrameBytes;
+        uint32_t totalBytes;
+        /// longest single chunk sent to the display
+        uint32_t maxUpdateUs;
+    };
+
     void begin();
+    /**
+     * @brief Sends the next chunk of the last drawn frame, must be called every loop.
+     *
+     * Does nothing when the display renders and sends on a task of its own.
+     */
+    void update();
+    /**
+     * @brief Waits until the last drawn frame is on the display. For code outside of the loop.
+     */
+    void flush();
     void drawOpener();
-    void display(float weight, unsigned long time);
+    void display(int32_t weightMg, unsigned long time);
     void promptText(const char *prompt, const char *subtext);
     void centerText(const char *text, const uint8_t size);
     void modeSwitcher(const char *current, const uint8_t index, const uint8_t count, float batV, float batPercentage, bool batCharging);
@@ -20,4 +42,5 @@ namespace Display
     void espressoShot(uint32_t currentTimeMs, uint32_t timeToFinishMs, int32_t currentWeightMg, uint32_t targetWeightMg, bool waiting);
     void text(const char *text);
     void clear();
+    FrameCounters getFrameCounters();
 };
@@ -0,0 +1,57 @@
+/*
+  Generated by fonts/glyph_atlas.py from ./roboto_mono/regular-lat-20.bdf, do not edit.
+  Characters: -.0123456789:g
+*/
+#pragma once
+
+#include "glyph_atlas.h"
+
+static const uint8_t roboto_mono_20_atlas_bits[445] = {
+    0xff, 0x03, 0xff, 0x03, 0x02, 0x0f, 0x0f, 0x07, 0xf0, 0x01, 0xfc, 0x07, 0x0e, 0x07, 0x06, 0x0e,
+    0x07, 0x0c, 0x07, 0x1c, 0x07, 0x1c, 0x03, 0x1f, 0x83, 0x1f, 0xc3, 0x1d, 0xf3, 0x1c, 0x3b, 0x1c,
+    0x1f, 0x1c, 0x0f, 0x1c, 0x07, 0x1c, 0x07, 0x0c, 0x06, 0x0c, 0x0e, 0x0e, 0xfc, 0x07, 0xf8, 0x03,
+    0x80, 0xf0, 0xfe, 0xff, 0xe3, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0,
+    0xe0, 0xe0, 0xe0, 0xe0, 0xf0, 0x01, 0xfc, 0x07, 0x1e, 0x0f, 0x06, 0x0e, 0x07, 0x0c, 0x07, 0x1c,
+    0x00, 0x0c, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x07, 0x80, 0x03, 0x80, 0x01, 0xc0, 0x01, 0xe0, 0x00,
+    0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0xfe, 0x1f, 0xfe, 0x1f, 0xf0, 0x01, 0xfc, 0x07,
+    0x1e, 0x0e, 0x06, 0x0c, 0x06, 0x0c, 0x00, 0x1c, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x07, 0xf0, 0x03,
+    0xf0, 0x07, 0x00, 0x0e, 0x00, 0x0c, 0x00, 0x1c, 0x00, 0x1c, 0x07, 0x1c, 0x06, 0x0c, 0x0e, 0x0e,
+    0xfc, 0x07, 0xf8, 0x03, 0x00, 0x0e, 0x00, 0x0f, 0x80, 0x0f, 0x80, 0x0f, 0xc0, 0x0f, 0xe0, 0x0e,
+    0x60, 0x0e, 0x70, 0x0e, 0x30, 0x0e, 0x18, 0x0e, 0x1c, 0x0e, 0x0c, 0x0e, 0x06, 0x0e, 0xff, 0x3f,
+    0xff, 0x3f, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0xfe, 0x07, 0xfe, 0x07,
+    0xfe, 0x07, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0x06, 0x00, 0xf6, 0x00, 0xff, 0x03, 0xcf, 0x07,
+    0x00, 0x07, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x03, 0x0e, 0x03, 0x0e, 0x07, 0x07,
+    0xfe, 0x03, 0xfc, 0x01, 0x80, 0x03, 0xf0, 0x03, 0xf8, 0x01, 0x1c, 0x00, 0x0e, 0x00, 0x06, 0x00,
+    0x06, 0x00, 0xe7, 0x01, 0xff, 0x07, 0x1f, 0x07, 0x07, 0x0e, 0x07, 0x0c, 0x03, 0x0c, 0x03, 0x0c,
+    0x07, 0x0c, 0x07, 0x0c, 0x06, 0x0e, 0x0e, 0x07, 0xfc, 0x07, 0xf8, 0x01, 0xff, 0x1f, 0xff, 0x1f,
+    0x00, 0x1c, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x06, 0x00, 0x07, 0x00, 0x03, 0x80, 0x03, 0x80, 0x01,
+    0xc0, 0x01, 0xc0, 0x00, 0xc0, 0x00, 0xe0, 0x00, 0x60, 0x00, 0x70, 0x00, 0x30, 0x00, 0x38, 0x00,
+    0x18, 0x00, 0x1c, 0x00, 0xf0, 0x01, 0xfc, 0x07, 0x1c, 0x0f, 0x0e, 0x0e, 0x06, 0x0c, 0x06, 0x1c,
+    0x0e, 0x0c, 0x0e, 0x0e, 0x1c, 0x07, 0xf8, 0x03, 0xf8, 0x07, 0x0e, 0x0e, 0x06, 0x0c, 0x06, 0x1c,
+    0x07, 0x1c, 0x07, 0x1c, 0x06, 0x1c, 0x0e, 0x0e, 0xfc, 0x07, 0xf8, 0x03, 0xf0, 0x01, 0xfc, 0x03,
+    0x0e, 0x07, 0x06, 0x0e, 0x07, 0x0e, 0x07, 0x0c, 0x03, 0x0c, 0x07, 0x0c, 0x07, 0x0c, 0x07, 0x0e,
+    0x0e, 0x0f, 0xfc, 0x0f, 0xf8, 0x0d, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x06, 0x00, 0x07, 0xe0, 0x03,
+    0xf8, 0x01, 0x78, 0x00, 0x0e, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+    0x0e, 0x0f, 0x0e, 0xf0, 0x0c, 0xfc, 0x0f, 0x1e, 0x0f, 0x0e, 0x0e, 0x07, 0x0c, 0x07, 0x0c, 0x03,
+    0x0c, 0x03, 0x0c, 0x03, 0x0c, 0x07, 0x0c, 0x07, 0x0c, 0x06, 0x0e, 0x0e, 0x0e, 0xfc, 0x0f, 0xf8,
+    0x0d, 0x00, 0x0c, 0x00, 0x0e, 0x06, 0x0e, 0x8e, 0x07, 0xfc, 0x03, 0xf0, 0x00,
+};
+
+static const AtlasGlyph roboto_mono_20_atlas_glyphs[14] = {
+    {'-', 16, 10, 2, 3, -10, 0},
+    {'.', 16, 4, 4, 7, -4, 4},
+    {'0', 16, 13, 20, 2, -20, 8},
+    {'1', 16, 8, 20, 3, -20, 48},
+    {'2', 16, 13, 20, 1, -20, 68},
+    {'3', 16, 13, 20, 1, -20, 108},
+    {'4', 16, 14, 20, 1, -20, 148},
+    {'5', 16, 12, 20, 3, -20, 188},
+    {'6', 16, 12, 20, 2, -20, 228},
+    {'7', 16, 13, 20, 2, -20, 268},
+    {'8', 16, 13, 20, 2, -20, 308},
+    {'9', 16, 12, 20, 2, -20, 348},
+    {':', 16, 4, 15, 7, -15, 388},
+    {'g', 16, 12, 21, 2, -15, 403},
+};
+
+static const GlyphAtlas roboto_mono_20_atlas = {roboto_mono_20_atlas_glyphs, 14, roboto_mono_20_atlas_bits, 29, 7};
\ No newline at end of file
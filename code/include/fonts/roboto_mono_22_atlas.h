@@ -0,0 +1,61 @@
+/*
+  Generated by fonts/glyph_atlas.py from ./roboto_mono/regular-lat-22.bdf, do not edit.
+  Characters: -.0123456789:g
+*/
+#pragma once
+
+#include "glyph_atlas.h"
+
+static const uint8_t roboto_mono_22_atlas_bits[511] = {
+    0xff, 0x0f, 0xff, 0x0f, 0xff, 0x0f, 0x0e, 0x1e, 0x1f, 0x0e, 0xf0, 0x03, 0xf8, 0x0f, 0x3c, 0x1e,
+    0x0e, 0x1c, 0x0e, 0x38, 0x07, 0x38, 0x07, 0x38, 0x07, 0x3c, 0x07, 0x3e, 0x07, 0x3f, 0xc7, 0x3b,
+    0xe7, 0x39, 0x77, 0x38, 0x3f, 0x38, 0x1f, 0x38, 0x07, 0x38, 0x07, 0x38, 0x06, 0x38, 0x0e, 0x1c,
+    0x1c, 0x1e, 0xfc, 0x0f, 0xf0, 0x07, 0x00, 0x01, 0xe0, 0x01, 0xfc, 0x01, 0xff, 0x01, 0xcf, 0x01,
+    0xc1, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01,
+    0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01, 0xc0, 0x01,
+    0xc0, 0x01, 0xf0, 0x03, 0xf8, 0x0f, 0x3c, 0x1e, 0x0e, 0x1c, 0x06, 0x38, 0x07, 0x38, 0x07, 0x38,
+    0x00, 0x38, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x0f, 0x80, 0x07, 0x80, 0x03, 0xc0, 0x01,
+    0xe0, 0x00, 0x70, 0x00, 0x38, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0xfe, 0x7f, 0xfe, 0x7f, 0xf0, 0x03,
+    0xf8, 0x0f, 0x3c, 0x1e, 0x0e, 0x1c, 0x0e, 0x38, 0x06, 0x38, 0x00, 0x38, 0x00, 0x38, 0x00, 0x1c,
+    0x00, 0x0e, 0xe0, 0x07, 0xe0, 0x0f, 0x00, 0x1e, 0x00, 0x38, 0x00, 0x38, 0x00, 0x38, 0x07, 0x38,
+    0x07, 0x38, 0x0e, 0x38, 0x1e, 0x1c, 0xfc, 0x0f, 0xf0, 0x07, 0x00, 0x1c, 0x00, 0x1e, 0x00, 0x1f,
+    0x00, 0x1f, 0x80, 0x1f, 0xc0, 0x1d, 0xc0, 0x1c, 0xe0, 0x1c, 0x60, 0x1c, 0x70, 0x1c, 0x38, 0x1c,
+    0x18, 0x1c, 0x1c, 0x1c, 0x0e, 0x1c, 0x06, 0x1c, 0xff, 0xff, 0xff, 0xff, 0x00, 0x1c, 0x00, 0x1c,
+    0x00, 0x1c, 0x00, 0x1c, 0x00, 0x1c, 0xfc, 0x1f, 0xfc, 0x1f, 0xfe, 0x1f, 0x0e, 0x00, 0x0e, 0x00,
+    0x0e, 0x00, 0x0e, 0x00, 0x0e, 0x00, 0xf6, 0x03, 0xfe, 0x07, 0x9e, 0x0f, 0x04, 0x1e, 0x00, 0x1c,
+    0x00, 0x1c, 0x00, 0x18, 0x00, 0x18, 0x03, 0x18, 0x07, 0x1c, 0x07, 0x1c, 0x0e, 0x0e, 0xfc, 0x0f,
+    0xf8, 0x03, 0x00, 0x07, 0xe0, 0x07, 0xf0, 0x07, 0x78, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x0e, 0x00,
+    0x06, 0x00, 0xe7, 0x07, 0xff, 0x0f, 0x1f, 0x1e, 0x0f, 0x1c, 0x07, 0x38, 0x07, 0x38, 0x07, 0x38,
+    0x07, 0x38, 0x07, 0x38, 0x0e, 0x18, 0x0e, 0x1c, 0x1c, 0x1e, 0xf8, 0x0f, 0xf0, 0x03, 0xff, 0x3f,
+    0xff, 0x3f, 0xff, 0x3f, 0x00, 0x38, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x0c, 0x00, 0x0e, 0x00, 0x06,
+    0x00, 0x07, 0x00, 0x03, 0x80, 0x03, 0x80, 0x03, 0xc0, 0x01, 0xc0, 0x01, 0xe0, 0x00, 0xe0, 0x00,
+    0x60, 0x00, 0x70, 0x00, 0x30, 0x00, 0x38, 0x00, 0x38, 0x00, 0xf0, 0x01, 0xfc, 0x07, 0x1e, 0x0f,
+    0x0e, 0x1e, 0x07, 0x1c, 0x07, 0x1c, 0x07, 0x1c, 0x07, 0x1c, 0x0e, 0x0e, 0x1e, 0x0f, 0xf8, 0x03,
+    0xfc, 0x07, 0x0e, 0x0e, 0x07, 0x1c, 0x07, 0x1c, 0x03, 0x18, 0x03, 0x18, 0x07, 0x1c, 0x07, 0x1c,
+    0x0e, 0x1e, 0xfe, 0x0f, 0xf8, 0x03, 0xf0, 0x03, 0xf8, 0x07, 0x3c, 0x0f, 0x0e, 0x1c, 0x0e, 0x1c,
+    0x07, 0x18, 0x07, 0x38, 0x07, 0x38, 0x07, 0x38, 0x07, 0x38, 0x0e, 0x3c, 0x0e, 0x3c, 0xfc, 0x3f,
+    0xf8, 0x3b, 0xe0, 0x18, 0x00, 0x18, 0x00, 0x1c, 0x00, 0x0e, 0x00, 0x0f, 0xf0, 0x07, 0xf8, 0x03,
+    0x78, 0x00, 0x0e, 0x0f, 0x0f, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e,
+    0x0f, 0x0f, 0x0e, 0xf8, 0x3b, 0xfc, 0x3f, 0x1e, 0x3e, 0x0e, 0x3c, 0x06, 0x38, 0x07, 0x38, 0x07,
+    0x38, 0x07, 0x38, 0x07, 0x38, 0x07, 0x38, 0x07, 0x38, 0x0e, 0x38, 0x0e, 0x3c, 0x1c, 0x3e, 0xfc,
+    0x3f, 0xf0, 0x3b, 0x00, 0x38, 0x00, 0x38, 0x04, 0x1c, 0x0e, 0x1e, 0xfc, 0x0f, 0xf8, 0x07,
+};
+
+static const AtlasGlyph roboto_mono_22_atlas_glyphs[14] = {
+    {'-', 18, 12, 3, 3, -11, 0},
+    {'.', 18, 5, 4, 7, -4, 6},
+    {'0', 18, 14, 22, 2, -22, 10},
+    {'1', 18, 9, 22, 3, -22, 54},
+    {'2', 18, 15, 22, 1, -22, 98},
+    {'3', 18, 14, 22, 1, -22, 142},
+    {'4', 18, 16, 22, 1, -22, 186},
+    {'5', 18, 13, 22, 3, -22, 230},
+    {'6', 18, 14, 22, 2, -22, 274},
+    {'7', 18, 14, 22, 2, -22, 318},
+    {'8', 18, 13, 22, 3, -22, 362},
+    {'9', 18, 14, 22, 2, -22, 406},
+    {':', 18, 4, 17, 8, -17, 450},
+    {'g', 18, 14, 22, 2, -16, 467},
+};
+
+static const GlyphAtlas roboto_mono_22_atlas = {roboto_mono_22_atlas_glyphs, 14, roboto_mono_22_atlas_bits, 32, 8};
\ No newline at end of file
@@ -0,0 +1,75 @@
+/*
+  Generated by fonts/glyph_atlas.py from ./roboto_mono/regular-lat-26.bdf, do not edit.
+  Characters: -.0123456789:g
+*/
+#pragma once
+
+#include "glyph_atlas.h"
+
+static const uint8_t roboto_mono_26_atlas_bits[736] = {
+    0xff, 0x1f, 0xff, 0x1f, 0xff, 0x1f, 0x06, 0x1f, 0x1f, 0x1f, 0x0f, 0xe0, 0x07, 0xf8, 0x1f, 0xfc,
+    0x3f, 0x1e, 0x78, 0x0e, 0x70, 0x07, 0xf0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xf0, 0x07, 0xf8, 0x07,
+    0xfe, 0x07, 0xef, 0x87, 0xe7, 0xe7, 0xe3, 0xf7, 0xe0, 0x7f, 0xe0, 0x3f, 0xe0, 0x0f, 0xe0, 0x07,
+    0xe0, 0x07, 0xe0, 0x07, 0xf0, 0x0f, 0x70, 0x1e, 0x78, 0x7c, 0x3e, 0xfc, 0x1f, 0xf0, 0x0f, 0x00,
+    0x02, 0xc0, 0x03, 0xf0, 0x03, 0xfe, 0x03, 0xff, 0x03, 0xcf, 0x03, 0xc1, 0x03, 0xc0, 0x03, 0xc0,
+    0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+    0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0, 0x03, 0xc0,
+    0x03, 0xc0, 0x03, 0xc0, 0x0f, 0x00, 0xf0, 0x3f, 0x00, 0xf8, 0x7f, 0x00, 0x3c, 0xf0, 0x00, 0x1e,
+    0xe0, 0x00, 0x0e, 0xe0, 0x00, 0x0e, 0xe0, 0x01, 0x0f, 0xe0, 0x01, 0x00, 0xe0, 0x00, 0x00, 0xe0,
+    0x00, 0x00, 0xf0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x78, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x1e, 0x00,
+    0x00, 0x0f, 0x00, 0x80, 0x07, 0x00, 0x80, 0x03, 0x00, 0xc0, 0x01, 0x00, 0xe0, 0x00, 0x00, 0xf0,
+    0x00, 0x00, 0x78, 0x00, 0x00, 0x3c, 0x00, 0x00, 0xfe, 0xff, 0x03, 0xfe, 0xff, 0x03, 0xfe, 0xff,
+    0x03, 0xe0, 0x07, 0xf8, 0x1f, 0xfc, 0x3f, 0x1e, 0x78, 0x0f, 0x70, 0x07, 0x70, 0x07, 0xf0, 0x00,
+    0xf0, 0x00, 0x70, 0x00, 0x70, 0x00, 0x38, 0x00, 0x3f, 0xe0, 0x0f, 0xe0, 0x1f, 0x00, 0x3e, 0x00,
+    0x78, 0x00, 0xf0, 0x00, 0xf0, 0x00, 0xe0, 0x07, 0xe0, 0x07, 0xf0, 0x0f, 0xf0, 0x0f, 0x78, 0x7e,
+    0x3e, 0xfc, 0x1f, 0xf0, 0x0f, 0x00, 0x70, 0x00, 0x00, 0x78, 0x00, 0x00, 0x7c, 0x00, 0x00, 0x7c,
+    0x00, 0x00, 0x7e, 0x00, 0x00, 0x7f, 0x00, 0x00, 0x77, 0x00, 0x80, 0x73, 0x00, 0x80, 0x73, 0x00,
+    0xc0, 0x71, 0x00, 0xe0, 0x70, 0x00, 0xe0, 0x70, 0x00, 0x70, 0x70, 0x00, 0x38, 0x70, 0x00, 0x38,
+    0x70, 0x00, 0x1c, 0x70, 0x00, 0x1e, 0x70, 0x00, 0xfe, 0xff, 0x07, 0xff, 0xff, 0x07, 0xff, 0xff,
+    0x07, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00,
+    0x00, 0x70, 0x00, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0xfc, 0xff, 0x1c, 0x00, 0x1c, 0x00, 0x1c,
+    0x00, 0x1c, 0x00, 0x1c, 0x00, 0x9c, 0x07, 0xfe, 0x1f, 0xfe, 0x3f, 0x3e, 0x7c, 0x08, 0xf0, 0x00,
+    0xf0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x00, 0xe0, 0x07, 0xe0, 0x0f, 0xe0, 0x0e, 0xf0, 0x1e,
+    0x70, 0x7c, 0x7e, 0xf8, 0x3f, 0xf0, 0x0f, 0x00, 0x1c, 0x00, 0x80, 0x1f, 0x00, 0xe0, 0x1f, 0x00,
+    0xf0, 0x03, 0x00, 0xf8, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e,
+    0x00, 0x00, 0x8e, 0x0f, 0x00, 0xee, 0x3f, 0x00, 0xfe, 0x7f, 0x00, 0x3e, 0x78, 0x00, 0x1e, 0xf0,
+    0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x00, 0x0f, 0xe0, 0x01, 0x0e, 0xe0, 0x01, 0x0e, 0xe0, 0x01,
+    0x0e, 0xe0, 0x01, 0x1e, 0xe0, 0x00, 0x1e, 0xe0, 0x00, 0x3c, 0xf0, 0x00, 0xf8, 0x7e, 0x00, 0xf0,
+    0x3f, 0x00, 0xe0, 0x1f, 0x00, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0xff, 0xff, 0x01, 0x00, 0xc0,
+    0x01, 0x00, 0xe0, 0x00, 0x00, 0xe0, 0x00, 0x00, 0x70, 0x00, 0x00, 0x70, 0x00, 0x00, 0x78, 0x00,
+    0x00, 0x38, 0x00, 0x00, 0x3c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x1c, 0x00, 0x00, 0x0e, 0x00, 0x00,
+    0x0e, 0x00, 0x00, 0x07, 0x00, 0x00, 0x07, 0x00, 0x80, 0x03, 0x00, 0x80, 0x03, 0x00, 0xc0, 0x03,
+    0x00, 0xc0, 0x01, 0x00, 0xe0, 0x01, 0x00, 0xe0, 0x00, 0x00, 0xf0, 0x00, 0x00, 0x70, 0x00, 0x00,
+    0x78, 0x00, 0x00, 0xe0, 0x07, 0xf8, 0x1f, 0xfc, 0x3f, 0x3c, 0x78, 0x1e, 0x70, 0x0e, 0xf0, 0x0e,
+    0xe0, 0x0e, 0xe0, 0x0e, 0xf0, 0x1e, 0x70, 0x1c, 0x78, 0xf8, 0x3f, 0xf0, 0x1f, 0xf8, 0x1f, 0x3c,
+    0x7c, 0x1e, 0x70, 0x0e, 0xe0, 0x0f, 0xe0, 0x07, 0xe0, 0x07, 0xe0, 0x0f, 0xe0, 0x0f, 0xe0, 0x1e,
+    0xf0, 0x7c, 0x7e, 0xf8, 0x3f, 0xf0, 0x0f, 0xe0, 0x07, 0xf8, 0x0f, 0xfc, 0x1f, 0x1e, 0x3c, 0x0f,
+    0x78, 0x07, 0x70, 0x07, 0x70, 0x07, 0xf0, 0x07, 0xf0, 0x07, 0xe0, 0x07, 0xe0, 0x07, 0xf0, 0x0f,
+    0xf0, 0x1e, 0xf8, 0x3e, 0xfe, 0xfc, 0x7f, 0xf8, 0x77, 0x00, 0x70, 0x00, 0x70, 0x00, 0x78, 0x00,
+    0x38, 0x00, 0x1c, 0x00, 0x1f, 0xf8, 0x0f, 0xf8, 0x03, 0xf8, 0x00, 0x0f, 0x1f, 0x1f, 0x1f, 0x0e,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x0f, 0x1f, 0x1f, 0x0f, 0xe0,
+    0xcf, 0x01, 0xf8, 0xff, 0x01, 0xfc, 0xfc, 0x01, 0x3c, 0xf0, 0x01, 0x1e, 0xe0, 0x01, 0x0e, 0xe0,
+    0x01, 0x0e, 0xe0, 0x01, 0x0e, 0xe0, 0x01, 0x0f, 0xe0, 0x01, 0x0f, 0xe0, 0x01, 0x0f, 0xe0, 0x01,
+    0x0e, 0xe0, 0x01, 0x0e, 0xe0, 0x01, 0x0e, 0xe0, 0x01, 0x1e, 0xe0, 0x01, 0x3c, 0xf0, 0x01, 0xfc,
+    0xfe, 0x01, 0xf8, 0xff, 0x01, 0xe0, 0xef, 0x01, 0x00, 0xe0, 0x01, 0x00, 0xe0, 0x00, 0x00, 0xe0,
+    0x00, 0x0c, 0xf0, 0x00, 0x3c, 0x7c, 0x00, 0xf8, 0x3f, 0x00, 0xf0, 0x1f, 0x00, 0x00, 0x01, 0x00,
+};
+
+static const AtlasGlyph roboto_mono_26_atlas_glyphs[14] = {
+    {'-', 21, 13, 3, 4, -13, 0},
+    {'.', 21, 5, 5, 9, -5, 6},
+    {'0', 21, 16, 26, 3, -26, 11},
+    {'1', 21, 10, 26, 4, -26, 63},
+    {'2', 21, 18, 26, 1, -26, 115},
+    {'3', 21, 16, 26, 2, -26, 193},
+    {'4', 21, 19, 26, 1, -26, 245},
+    {'5', 21, 16, 26, 3, -26, 323},
+    {'6', 21, 17, 26, 2, -26, 375},
+    {'7', 21, 17, 26, 2, -26, 453},
+    {'8', 21, 16, 26, 3, -26, 531},
+    {'9', 21, 16, 26, 3, -26, 583},
+    {':', 21, 5, 20, 10, -20, 635},
+    {'g', 21, 17, 27, 2, -19, 655},
+};
+
+static const GlyphAtlas roboto_mono_26_atlas = {roboto_mono_26_atlas_glyphs, 14, roboto_mono_26_atlas_bits, 37, 9};
\ No newline at end of file
@@ -1,8 +1,27 @@
 #pragma once
 
+#include <stdint.h>
+
 namespace LoadCell
 {
+    struct Sample
+    {
+        /// Time the HX711 signaled data ready in microseconds.
+        uint64_t timestampUs;
+        /// Raw value of the HX711.
+        long value;
+    };
+
+    /**
+     * @brief Starts acquisition of samples, can be called multiple times.
+     */
     void begin();
-    long read();
+    /**
+     * @brief Reads the oldest sample that was not read yet.
+     */
+    Sample read();
+    /**
+     * @brief Returns true if there is a sample that was not read yet.
+     */
     bool isReady();
 };
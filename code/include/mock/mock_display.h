@@ -1,13 +1,25 @@
 #pragma once
 
+#include <vector>
 #include "display.h"
 
 namespace Display
 {
+    struct Call
+    {
+        uint64_t timeUs;
+        const char *function;
+    };
+
+    /// When set, every call is appended to calls with the time from nowUs()
+    inline bool recordCalls = false;
+    inline std::vector<Call> calls;
+
     inline char *lastCenterText = nullptr;
     inline char *lastModeText = nullptr;
 
-    inline float weight = NAN;
+    /// INT32_MIN until a weight is displayed
+    inline int32_t weightMg = INT32_MIN;
     inline unsigned long time = -1;
     inline uint8_t switcherIndex = 0xFF;
     inline uint8_t switcherCount = 0xFF;
@@ -48,7 +60,7 @@ namespace Display
         recipeDescription = nullptr;
         weightConfigHeader = nullptr;
 
-        weight = NAN;
+        weightMg = INT32_MIN;
         time = -1;
         switcherIndex = 0xFF;
         switcherCount = 0xFF;
@@ -68,5 +80,8 @@ namespace Display
         espressoTimeToFinishMs = 0;
         espressoCurrentWeightMg = 0;
         espressoTargetWeightMg = 0;
+
+        recordCalls = false;
+        calls.clear();
     }
 }
\ No newline at end of file
@@ -8,6 +8,7 @@ namespace Interface
     extern ClickType bootClick;
     extern int encoderTicks;
     extern EncoderDirection encoderDirection;
+    extern unsigned int buzzerToneCount;
 
     void reset();
 }
\ No newline at end of file
@@ -5,4 +5,6 @@
 namespace LoadCell {
     extern long value;
     extern bool ready;
+    /// Capture time of the sample, 0 uses the current time
+    extern uint64_t timestampUs;
 }
\ No newline at end of file
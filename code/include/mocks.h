@@ -11,11 +11,28 @@ class MockWeightSensor : public WeightSensor
 {
 public:
     float getWeight() override { return weight; }
+    int32_t getWeightMg() override { return lroundf(weight * 1000); }
     bool isNewWeight() override { return newWeight; }
     void tare() override { weight = 0; }
     void setScale(float scale) override {}
     float getLastWeight() override { return weight; }
     float getLastUntaredWeight() { return -1.0f; }
+    WeightSample getLastSample() override
+    {
+        return {timestampUs ? timestampUs : nowUs(), 0, getWeightMg(), -1000, getWeightMg(), 0, true};
+    }
+    /**
+     * @brief Pushes the current weight to subscribers if newWeight is set.
+     */
+    void update() override
+    {
+        if (newWeight)
+        {
+            publish(getLastSample());
+        }
+    }
     float weight = 0;
     bool newWeight = false;
+    /// Timestamp of the last sample, 0 uses the current time
+    uint64_t timestampUs = 0;
 };
\ No newline at end of file
@@ -0,0 +1,9 @@
+# Native builds only use the portable C core of U8g2, the C++ wrapper needs Arduino.
+Import("env")
+
+
+def skip_arduino_wrapper(node):
+    return None
+
+
+env.AddBuildMiddleware(skip_arduino_wrapper, "*/U8g2/src/U8*lib.cpp")
\ No newline at end of file
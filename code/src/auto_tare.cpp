@@ -1,6 +1,7 @@
 #include <math.h>
 
 #include "auto_tare.h"
+#include "formatters.h"
 #include "logger.h"
 
 #define TAG "Auto Tare"
@@ -14,30 +15,34 @@ AutoTare::AutoTare(float toleranceG, float maxStdDevG, uint16_t bufferSize)
 {
 }
 
+void AutoTare::onSample(const WeightSample &sample) { update(sample.untaredMg / 1000.0f); }
+
 void AutoTare::update(float rawWeight)
 {
     buffer.push(rawWeight);
 
     // do nothing if bufer isnt full yet
-    if (buffer.capacity() != buffer.size())
+    if (!buffer.isFull())
     {
         return;
     }
 
     // check if stable, i.e. stdDev is under threshold
-    if (buffer.standardDeviationLast(buffer.size()) < maxStdDev)
+    if (buffer.standardDeviation() < maxStdDev)
     {
-        float avgWeight = buffer.averageLast(buffer.size());
+        float avgWeight = buffer.average();
 
         // only use stable weight if there is some siginificant diff
         if (!isCloseTo(STABLE_WEIGHT_DIFF, lastStableWeight, avgWeight))
         {
             float diff = avgWeight - lastStableWeight;
+            char text[FORMAT_BUFFER_SIZE];
 
             // only tare if the diff is positive
             if (diff > 0)
             {
-                LOGI(TAG, "got new diff: %f\n", diff);
+                formatWeight(text, lroundf(diff * 1000));
+                LOGI(TAG, "got new diff: %s\n", text);
 
                 // if the diff is similar to any saved weight, tare
                 for (float weight : weights)
@@ -50,7 +55,8 @@ void AutoTare::update(float rawWeight)
             }
 
             // set the last stable one to this one
-            LOGI(TAG, "new last stable weight: %f\n", avgWeight);
+            formatWeight(text, lroundf(avgWeight * 1000));
+            LOGI(TAG, "new last stable weight: %s\n", text);
             lastStableWeight = avgWeight;
         }
     }
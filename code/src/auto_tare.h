@@ -2,23 +2,31 @@
 
 #include <vector>
 #include "ring_buffer.h"
+#include "weight_sensor.h"
 
-class AutoTare {
+#define AUTO_TARE_MAX_BUFFER_SIZE 32
+
+class AutoTare : public WeightSampleSubscriber {
 public:
     /**
      * Auto Tare tares the scale automatically, when it detects a known weight increment.
      * 
      * To achieve this, we maintain a list of "stable" weights. Once a stable weight changes to another stable weight,
      * we compare it to the list of known weight. If theres a match, shouldTare will return true, until its called once.
+     * The buffer size is capped at AUTO_TARE_MAX_BUFFER_SIZE.
      */
     AutoTare(float tolerance, float maxStdDev, uint16_t bufferSize);
     bool shouldTare();
     void update(float rawWeight);
+    /**
+     * @brief Updates with the untared weight of the sample.
+     */
+    void onSample(const WeightSample &sample) override;
     std::vector<float> weights;
     float tolerance;
     float maxStdDev;
 private:
-    RingBuffer<float> buffer;
+    StatsRingBuffer<float, AUTO_TARE_MAX_BUFFER_SIZE> buffer;
     bool isTare = false;
 
     float lastStableWeight = NAN;
@@ -56,7 +56,7 @@ private:
     unsigned long doubleClickWaitTime;
     unsigned long longClickDelay;
 
-    unsigned long lastPressChangeTime = 0;
+    uint64_t lastPressChangeTime = 0;
     bool lastButtonState = false;
     bool buttonStateDebounced = false;
 
@@ -68,7 +68,7 @@ private:
         STATE_LONGPRESS,
     };
     States state = STATE_LOW;
-    unsigned long lastPressTime = 0;
-    unsigned long lastReleaseTime = 0;
+    uint64_t lastPressTime = 0;
+    uint64_t lastReleaseTime = 0;
     ClickType clickType = ClickType::NONE;
 };
\ No newline at end of file
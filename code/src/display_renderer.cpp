@@ -0,0 +1,637 @@
+// needs u8g2, natively only built for the framebuffer backend
+#if !defined(NATIVE) || defined(NATIVE_FRAMEBUFFER)
+
+#include <cstring>
+#include <math.h>
+#include <qrcode.h>
+
+#include "display_renderer.h"
+#include "formatters.h"
+#include "glyph_atlas.h"
+#include "millis.h"
+#include "data/bitmaps.h"
+#include "data/localization.h"
+#include "fonts/roboto_mono_20_atlas.h"
+#include "fonts/roboto_mono_22_atlas.h"
+#include "fonts/roboto_mono_26_atlas.h"
+
+#define Y_PADDING 4
+
+#define FONT_SMALL u8g2_font_profont12_tf
+#define FONT_SMALL_MEDIUM u8g2_font_profont15_tf
+#define FONT_MEDIUM u8g2_font_profont17_tf
+#define FONT_LARGE u8g2_font_logisoso20_tf
+
+// the descender of the g still ends above the time
+#define WEIGHT_BASELINE 26
+#define TIME_BASELINE 64
+
+// 26, 22 and 20 pt Roboto Mono, with digits of 26, 22 and 20 px height and 21, 18 and 16 px advance.
+// Monospaced, so the largest size only fits weights up to 6 characters like "36.00g"
+static const GlyphAtlas *const WEIGHT_ATLASES[] = {&roboto_mono_26_atlas, &roboto_mono_22_atlas, &roboto_mono_20_atlas};
+#define WEIGHT_ATLAS_COUNT (sizeof(WEIGHT_ATLASES) / sizeof(WEIGHT_ATLASES[0]))
+
+int DisplayRenderer::textWidth(const char *text)
+{
+    return widths.width(text, u8g.getU8g2()->font, [this](const char *measured) { return u8g.getUTF8Width(measured); });
+}
+
+void DisplayRenderer::drawHCenterText(const char *text, uint8_t y)
+{
+    u8g.drawUTF8(u8g.getDisplayWidth() / 2.0 - textWidth(text) / 2.0, y, text);
+}
+
+void DisplayRenderer::drawCenterText(const char *text)
+{
+    drawHCenterText(text, u8g.getDisplayHeight() / 2.0 + u8g.getFontAscent() / 2.0);
+}
+
+int DisplayRenderer::drawTitleLine(const char *title)
+{
+    u8g.setFont(FONT_SMALL);
+
+    int ascent = u8g.getAscent();
+    int descent = u8g.getDescent();
+    int width = u8g.getDisplayWidth();
+    int yy = ascent - descent;
+
+    // draw title line
+    u8g.drawUTF8(width / 2.0 - textWidth(title) / 2.0, yy, title);
+    yy += Y_PADDING;
+    u8g.drawHLine(0, yy, width);
+    return yy;
+}
+
+static bool shouldBlinkedBeVisible()
+{
+    // return false each 4th second
+    return now() % 1000 > 200;
+}
+
+void DisplayRenderer::encodeQRCode(const char *text)
+{
+    static QRCode qrcode;
+    static uint8_t *qrCodeBytes = new uint8_t[qrcode_getBufferSize(QR_CODE_VERSION)];
+
+    qrcode_initText(&qrcode, qrCodeBytes, QR_CODE_VERSION, ECC_QUARTILE, text);
+
+    // start light, the border stays that way
+    memset(qrCodeBits, 0xff, sizeof(qrCodeBits));
+    for (uint8_t y = 0; y < qrcode.size; y++)
+    {
+        for (uint8_t x = 0; x < qrcode.size; x++)
+        {
+            if (!qrcode_getModule(&qrcode, x, y))
+            {
+                continue;
+            }
+
+            for (uint8_t py = 2 * y + QR_CODE_BORDER; py < 2 * y + QR_CODE_BORDER + 2; py++)
+            {
+                for (uint8_t px = 2 * x + QR_CODE_BORDER; px < 2 * x + QR_CODE_BORDER + 2; px++)
+                {
+                    qrCodeBits[py * QR_CODE_ROW_BYTES + px / 8] &= ~(1 << (px % 8));
+                }
+            }
+        }
+    }
+}
+
+int DisplayRenderer::drawQRCode(const char *text, uint8_t posX, uint8_t posY)
+{
+    // the url does not change while a summary shows, only encode it when it does
+    if (qrCodeUrl[0] == '\0' || strcmp(text, qrCodeUrl) != 0)
+    {
+        encodeQRCode(text);
+        if (strlen(text) < QR_CODE_URL_SIZE)
+        {
+            strcpy(qrCodeUrl, text);
+        }
+        else
+        {
+            qrCodeUrl[0] = '\0';
+        }
+    }
+
+    u8g.drawXBM(posX, posY, QR_CODE_PIXELS, QR_CODE_PIXELS, qrCodeBits);
+    return QR_CODE_PIXELS;
+}
+
+int DisplayRenderer::drawSelectedBar(uint8_t index, uint8_t size)
+{
+    int width = u8g.getDisplayWidth();
+    int ascent = u8g.getAscent();
+
+    // display header shwoing number of pours as rectangles with current pur highlighted by a filled rectangle
+    static const int PROGRESS_HEIGHT = 4;
+    int boxWidth = width / size;
+    u8g.drawFrame(0, 0, width, PROGRESS_HEIGHT);
+    for (int i = 1; i < size; i++)
+    {
+        u8g.drawVLine(i * boxWidth, 0, PROGRESS_HEIGHT);
+    }
+    u8g.drawBox(index * boxWidth, 0, boxWidth, PROGRESS_HEIGHT);
+
+    return PROGRESS_HEIGHT;
+}
+
+void DisplayRenderer::drawTextAutoWrap(const char *text, int yTop, int xLeft, int maxWidth)
+{
+    u8g.setFont(u8g_font_6x10);
+    int lineHeight = u8g.getAscent() - u8g.getDescent();
+
+    // notes and descriptions stay the same while shown, only the first frame measures the words
+    layout.wrap(text, u8g.getU8g2()->font, xLeft, maxWidth, [this](const char *word) { return u8g.getUTF8Width(word); });
+    for (uint8_t i = 0; i < layout.getRunCount(); i++)
+    {
+        const TextRun &run = layout.getRun(i);
+        u8g.drawUTF8(run.x, yTop + (run.line + 1) * lineHeight, run.text);
+    }
+}
+
+bool DisplayRenderer::opener(const char *version)
+{
+    u8g.clearBuffer();
+
+    u8g.drawXBM(0, 0, chemex_width, chemex_height, chemex_bits);
+
+    u8g.setFont(u8g_font_10x20);
+    const static char *textLine1 = "Coffee";
+    const static char *textLine2 = "Scale";
+    int ascent = u8g.getAscent();
+    int width = u8g.getDisplayWidth();
+    int height = u8g.getDisplayHeight();
+
+    int remainingCenter = chemex_width + (width - chemex_width) / 2.0;
+
+    int textWidth = u8g.getStrWidth(textLine1);
+    int yy = 6 + ascent;
+    u8g.drawStr(remainingCenter - textWidth / 2.0, yy, textLine1);
+    yy += ascent + 4;
+    textWidth = u8g.getStrWidth(textLine2);
+    u8g.drawStr(remainingCenter - textWidth / 2.0, yy, textLine2);
+
+    u8g.setFont(u8g_font_7x13);
+    ascent = u8g.getAscent();
+    const static char *textLineUrl = "orlopau.dev";
+    
+    yy += ascent + 5;
+    textWidth = u8g.getStrWidth(textLineUrl);
+    u8g.drawStr(remainingCenter - textWidth / 2.0, yy, textLineUrl);
+
+    u8g.setFont(u8g_font_6x12);
+    ascent = u8g.getAscent();
+    textWidth = u8g.getStrWidth(version);
+    u8g.drawStr(remainingCenter - textWidth / 2.0, height - 2, version);
+
+    // the opener bypasses the view state, make sure the next screen replaces it
+    frames.invalidate();
+    return true;
+}
+
+bool DisplayRenderer::weight(int32_t weightMg, unsigned long time)
+{
+    char weightText[FORMAT_BUFFER_SIZE];
+    char timeText[FORMAT_BUFFER_SIZE];
+    formatWeight(weightText, weightMg);
+    formatTime(timeText, time);
+    if (!frames.shouldPush(ViewState(SCREEN_WEIGHT).addText(weightText).addText(timeText)))
+    {
+        return false;
+    }
+
+    // redrawn at the sample rate, so the digits are or-ed into the buffer instead of decoded by u8g2
+    u8g.clearBuffer();
+    uint8_t *buffer = u8g.getBufferPtr();
+    int width = u8g.getDisplayWidth();
+    int height = u8g.getDisplayHeight();
+    const GlyphAtlas *weightAtlas = fittingAtlas(WEIGHT_ATLASES, WEIGHT_ATLAS_COUNT, weightText, width);
+    if (weightAtlas == nullptr)
+    {
+        // drop the unit of weights like "-1234.56g" instead of clipping digits
+        weightText[strlen(weightText) - 1] = '\0';
+        weightAtlas = &roboto_mono_20_atlas;
+    }
+    drawAtlasText(buffer, width, height, *weightAtlas, 0, WEIGHT_BASELINE, weightText);
+    drawAtlasText(buffer, width, height, roboto_mono_22_atlas, 0, TIME_BASELINE, timeText);
+    return true;
+}
+
+bool DisplayRenderer::promptText(const char *prompt, const char *text)
+{
+    if (!frames.shouldPush(ViewState(SCREEN_PROMPT_TEXT).addText(prompt).addText(text)))
+    {
+        return false;
+    }
+
+    u8g.clearBuffer();
+    u8g.setFont(u8g_font_6x10);
+    u8g.drawStr(0, 10, prompt);
+    u8g.drawStr(0, 20, text);
+    return true;
+}
+
+bool DisplayRenderer::centerText(const char *text, const uint8_t size)
+{
+    if (!frames.shouldPush(ViewState(SCREEN_CENTER_TEXT).addText(text).add(size)))
+    {
+        return false;
+    }
+
+    u8g.clearBuffer();
+
+    int mid = 0;
+    switch (size)
+    {
+    case 13:
+        u8g.setFont(u8g_font_7x13);
+        mid = 32 + 6;
+        break;
+    case 16:
+        u8g.setFont(u8g2_font_logisoso16_tf);
+        mid = 32 + 8;
+        break;
+    case 30:
+        u8g.setFont(u8g2_font_logisoso30_tf);
+        mid = 32 + 15;
+        break;
+    default:
+        u8g.setFont(u8g_font_6x10);
+        mid = 32 + 5;
+        break;
+    }
+
+    drawHCenterText(text, mid);
+    return true;
+}
+
+bool DisplayRenderer::switcher(const char *title, const uint8_t index, const uint8_t count, const char *options[])
+{
+    ViewState state(SCREEN_SWITCHER);
+    state.addText(title).add(index).add(count);
+    for (int i = 0; i < count; i++)
+    {
+        state.addText(options[i]);
+    }
+    if (!frames.shouldPush(state))
+    {
+        return false;
+    }
+
+    u8g.clearBuffer();
+
+    int yy = drawTitleLine(title);
+    yy += 2;
+
+    u8g.setFont(FONT_SMALL);
+    u8g.setFontPosBaseline();
+    int ascent = u8g.getAscent();
+    int descent = u8g.getDescent();
+    int height = u8g.getDisplayHeight();
+    int width = u8g.getDisplayWidth();
+
+    int optionHeight = ascent + 2;
+    int visibleOptionsCount = (height - yy) / optionHeight;
+    if (visibleOptionsCount > count)
+    {
+        visibleOptionsCount = count;
+    }
+
+    int firstVisibleOptionIndex = index - visibleOptionsCount / 2;
+    if (firstVisibleOptionIndex < 0)
+    {
+        firstVisibleOptionIndex = 0;
+    }
+    else if (firstVisibleOptionIndex + visibleOptionsCount > count)
+    {
+        // if last displayed item would be out of bounds, start displaying at the last possible item
+        firstVisibleOptionIndex = count - visibleOptionsCount;
+    }
+
+    // yy in for loop is the top of the current option
+    for (int i = 0; i < visibleOptionsCount; i++)
+    {
+        int optionIndex = firstVisibleOptionIndex + i;
+
+        // when option is selected, draw inverted
+        if (optionIndex == index)
+        {
+            u8g.drawBox(0, yy, width, optionHeight);
+            u8g.setDrawColor(0);
+        }
+
+        u8g.drawUTF8(2, yy + ascent + 1, options[optionIndex]);
+        u8g.setDrawColor(1);
+        yy += optionHeight;
+    }
+
+    return true;
+};
+
+bool DisplayRenderer::recipeSummary(const char *name, const char *description, const char *url)
+{
+    if (!frames.shouldPush(ViewState(SCREEN_RECIPE_SUMMARY).addText(name).addText(description).addText(url)))
+    {
+        return false;
+    }
+
+    u8g.clearBuffer();
+    u8g.setFont(u8g_font_6x10);
+
+    int ascent = u8g.getAscent();
+    int descent = u8g.getDescent();
+
+    int height = u8g.getDisplayHeight();
+    int width = u8g.getDisplayWidth();
+
+    if (url == nullptr)
+    {
+        int yy = drawTitleLine(name);
+        drawTextAutoWrap(description, yy + 2, 0, width);
+    }
+    else
+    {
+        // u8g.drawBox(0, 0, u8g.getWidth(), u8g.getHeight());
+        // u8g.setDrawColor(0);
+        drawTextAutoWrap(description, 0, 1, width - QR_CODE_PIXELS - 3);
+        // u8g.setDrawColor(1);
+
+        drawQRCode(url, width - QR_CODE_PIXELS, (height - QR_CODE_PIXELS) / 2.0);
+    }
+
+    return true;
+}
+
+bool DisplayRenderer::recipeConfigCoffeeWeight(const char *header, unsigned int weightMg, unsigned int waterWeightMl)
+{
+    bool weightVisible = shouldBlinkedBeVisible();
+    if (!frames.shouldPush(ViewState(SCREEN_RECIPE_CONFIG_WEIGHT).addText(header).add(weightMg).add(waterWeightMl).add(weightVisible)))
+    {
+        return false;
+    }
+
+    u8g.clearBuffer();
+    int yy = drawTitleLine(header);
+    yy += Y_PADDING;
+
+    int remainingHeight = u8g.getDisplayHeight() - yy;
+    char buffer[FORMAT_BUFFER_SIZE];
+    static const int X_OFFSET = 10;
+    // draw coffee string
+    u8g.setFontPosCenter();
+    u8g.setFont(FONT_SMALL_MEDIUM);
+    static const char *coffee = DISPLAY_CONFIG_WEIGHT_COFFEE;
+    u8g.drawStr(u8g.getDisplayWidth() / 2.0 - u8g.getStrWidth(coffee) - X_OFFSET, yy + (remainingHeight / 4.0), coffee);
+    if (weightVisible)
+    {
+        appendText(formatFixed(buffer, weightMg, 3, 1), "g");
+        u8g.setFont(FONT_MEDIUM);
+        u8g.drawStr(u8g.getWidth() / 2.0, yy + (remainingHeight / 4.0), buffer);
+    }
+
+    // draw water string
+    u8g.setFont(FONT_SMALL_MEDIUM);
+    static const char *water = DISPLAY_CONFIG_WEIGHT_WATER;
+    u8g.drawStr(u8g.getDisplayWidth() / 2.0 - u8g.getStrWidth(water) - X_OFFSET, yy + (remainingHeight / 4.0) * 3, water);
+    appendText(formatUnsigned(buffer, waterWeightMl), "ml");
+    u8g.setFont(FONT_MEDIUM);
+    u8g.drawStr(u8g.getWidth() / 2.0, yy + (remainingHeight / 4.0) * 3, buffer);
+
+    u8g.setFontPosBaseline();
+    return true;
+}
+
+bool DisplayRenderer::recipeConfigRatio(const char *header, uint32_t coffee, uint32_t water)
+{
+    bool waterVisible = shouldBlinkedBeVisible();
+    if (!frames.shouldPush(ViewState(SCREEN_RECIPE_CONFIG_RATIO).addText(header).add(coffee).add(water).add(waterVisible)))
+    {
+        return false;
+    }
+
+    u8g.clearBuffer();
+    int yy = drawTitleLine(header);
+    yy += 2 * Y_PADDING;
+
+    u8g.setFont(FONT_MEDIUM);
+    yy += u8g.getAscent();
+    drawHCenterText(DISPLAY_CONFIG_RATIO, yy);
+    yy += Y_PADDING;
+
+    u8g.setFont(FONT_LARGE);
+    yy += (u8g.getDisplayHeight() - yy) / 2.0 + u8g.getAscent() / 2.0;
+
+    // draw colon in center
+    u8g.drawStr(u8g.getDisplayWidth() / 2.0 - u8g.getStrWidth(":") / 2.0, yy, ":");
+
+    char buffer[FORMAT_BUFFER_SIZE];
+
+    // draw left side
+    formatFixed(buffer, coffee, 1, 1);
+    u8g.drawStr(u8g.getDisplayWidth() / 4.0 - u8g.getStrWidth(buffer) / 2.0, yy, buffer);
+    // draw right side, only if blink should show
+    if (waterVisible)
+    {
+        formatFixed(buffer, water, 1, 1);
+        u8g.drawStr(3 * u8g.getDisplayWidth() / 4.0 - u8g.getStrWidth(buffer) / 2.0, yy, buffer);
+    }
+
+    return true;
+}
+
+bool DisplayRenderer::recipeInsertCoffee(int32_t weightMg, uint32_t requiredWeightMg)
+{
+    char buffer[2 * FORMAT_BUFFER_SIZE];
+    char *end = appendText(formatWeight(buffer, weightMg), "/");
+    appendText(formatFixed(end, requiredWeightMg, 3, 1), "g");
+    if (!frames.shouldPush(ViewState(SCREEN_RECIPE_INSERT_COFFEE).addText(buffer)))
+    {
+        return false;
+    }
+
+    u8g.clearBuffer();
+    u8g.setFont(u8g_font_7x13);
+
+    drawHCenterText(DISPLAY_INSERT_COFFEE, u8g.getAscent() + 5);
+
+    u8g.setFont(u8g_font_9x18);
+    drawCenterText(buffer);
+
+    return true;
+}
+
+bool DisplayRenderer::recipePour(const char *text, int32_t weightToPourMg, uint64_t timeToFinishMs, bool isPause, uint8_t pourIndex, uint8_t pours)
+{
+    char weightBuffer[FORMAT_BUFFER_SIZE];
+    char timeBuffer[FORMAT_BUFFER_SIZE];
+    formatWeight(weightBuffer, -weightToPourMg);
+    char *end = appendText(timeBuffer, isPause ? "TP-" : "T-");
+    end = appendText(formatUnsigned(end, timeToFinishMs / 1000 / 60, 2), ":");
+    formatUnsigned(end, timeToFinishMs / 1000 % 60, 2);
+    if (!frames.shouldPush(ViewState(SCREEN_RECIPE_POUR).addText(text).addText(weightBuffer).addText(timeBuffer).add(pourIndex).add(pours)))
+    {
+        return false;
+    }
+
+    u8g.clearBuffer();
+    u8g.setFont(u8g_font_6x10);
+
+    int width = u8g.getDisplayWidth();
+    int ascent = u8g.getAscent();
+
+    // display header shwoing number of pours as rectangles with current pur highlighted by a filled rectangle
+    int yy = drawSelectedBar(pourIndex, pours);
+
+    // draw info text
+    yy += 2;
+    drawTextAutoWrap(text, yy, 0, width);
+
+    // draw bottom: time and weight
+    u8g.setFont(u8g_font_7x13);
+    yy = u8g.getDisplayHeight() - (u8g.getAscent() - u8g.getDescent()) - 6;
+    u8g.drawHLine(0, yy, width);
+    yy += 3;
+
+    // get center of remaining y space
+    int center = yy + (u8g.getDisplayHeight() - yy) / 2.0;
+
+    // TODO add lines showing progress of weight and time
+    const static int Y_SPACING = 5;
+
+    const static int TEXT_X_PADDING = 3;
+    u8g.drawStr(TEXT_X_PADDING, center + ascent / 2.0, weightBuffer);
+
+    int textWidth = u8g.getStrWidth(timeBuffer);
+    u8g.drawStr(width - textWidth - TEXT_X_PADDING, center + ascent / 2.0, timeBuffer);
+
+    return true;
+}
+
+bool DisplayRenderer::text(const char *text)
+{
+    if (!frames.shouldPush(ViewState(SCREEN_TEXT).addText(text)))
+    {
+        return false;
+    }
+
+    u8g.clearBuffer();
+    u8g.setFont(u8g_font_6x10);
+
+    // split string at newline
+    layout.split(text, '\n');
+    for (uint8_t i = 0; i < layout.getRunCount(); i++)
+    {
+        const TextRun &run = layout.getRun(i);
+        u8g.drawStr(run.x, 10 + run.line * 10, run.text);
+    }
+
+    return true;
+}
+
+bool DisplayRenderer::modeSwitcher(const char *current, const uint8_t index, const uint8_t count, float batV, float batPercentage, bool batCharging)
+{
+    uint16_t batGlyph = 0x0030;
+    char voltageBuffer[FORMAT_BUFFER_SIZE];
+    if (batCharging)
+    {
+        batGlyph += 6;
+        voltageBuffer[0] = '\0';
+    }
+    else
+    {
+        batGlyph += roundf(batPercentage / 20);
+        appendText(formatFixed(voltageBuffer, lroundf(batV * 1000), 3, 2), "V");
+    }
+    if (!frames.shouldPush(ViewState(SCREEN_MODE_SWITCHER).addText(current).add(index).add(count).add(batGlyph).addText(voltageBuffer)))
+    {
+        return false;
+    }
+
+    u8g.clearBuffer();
+
+    drawSelectedBar(index, count);
+
+    u8g.setFont(u8g_font_10x20);
+    drawCenterText(current);
+
+    // battery state
+    u8g.setFont(u8g2_font_battery19_tn);
+    u8g.setFontDirection(1);
+    static const int PADDING = 5;
+    u8g.drawGlyph(PADDING, u8g.getDisplayHeight() - 8 - PADDING, batGlyph);
+    u8g.setFontDirection(0);
+
+    if (!batCharging)
+    {
+        u8g.setFont(u8g_font_6x10);
+        int textWidth = u8g.getUTF8Width(voltageBuffer);
+        u8g.drawUTF8(u8g.getDisplayWidth() - textWidth - PADDING, u8g.getDisplayHeight() - PADDING, voltageBuffer);
+    }
+
+    return true;
+}
+
+bool DisplayRenderer::espressoShot(uint32_t currentTimeMs, uint32_t timeToFinishMs, int32_t currentWeightMg, uint32_t targetWeightMg,
+                               bool waiting)
+{
+    int width = u8g.getDisplayWidth();
+    int height = u8g.getDisplayHeight();
+
+    int barHeight = 5;
+    int barWidth = width;
+
+    // time to finish
+    char timeBuffer[2 * FORMAT_BUFFER_SIZE];
+    char *end = timeBuffer;
+    if (!waiting)
+    {
+        end = appendText(formatFixed(end, -(int64_t)timeToFinishMs, 3, 1), "s|");
+    }
+    appendText(formatFixed(end, currentTimeMs, 3, 1), "s");
+
+    // current weight in g
+    char weightBuffer[2 * FORMAT_BUFFER_SIZE];
+    end = appendText(formatFixed(weightBuffer, currentWeightMg, 3, 1), "g/");
+    appendText(formatFixed(end, targetWeightMg, 3, 1), "g");
+
+    int barProgress = ((float)currentWeightMg / targetWeightMg) * barWidth;
+    if (!frames.shouldPush(ViewState(SCREEN_ESPRESSO_SHOT).addText(timeBuffer).addText(weightBuffer).add(barProgress)))
+    {
+        return false;
+    }
+
+    u8g.clearBuffer();
+
+    u8g.setFont(u8g2_font_logisoso18_tf);
+    int ascent = u8g.getAscent();
+
+    int yy = 4;
+
+    // draw time to finish
+    int textWidth = u8g.getUTF8Width(timeBuffer);
+    u8g.drawUTF8(width / 2.0 - textWidth / 2.0, yy + ascent, timeBuffer);
+
+    // change font
+    u8g.setFont(u8g2_font_logisoso16_tf);
+
+    // draw current weight in g
+    textWidth = u8g.getUTF8Width(weightBuffer);
+    u8g.drawUTF8(width / 2.0 - textWidth / 2.0, height - barHeight - 8, weightBuffer);
+
+    // draw full width weight progress bar on bottom
+    int barY = height - barHeight;
+    int barX = 0;
+    u8g.drawFrame(barX, barY, barWidth, barHeight);
+    u8g.drawBox(barX, barY, barProgress, barHeight);
+
+    return true;
+}
+
+bool DisplayRenderer::clear()
+{
+    u8g.clearBuffer();
+    frames.invalidate();
+    return false;
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <stdint.h>
+
+#include "text_layout.h"
+#include "view_state.h"
+
+#ifdef NATIVE
+#include "native/u8g2_framebuffer.h"
+typedef U8g2Framebuffer DisplayBuffer;
+#else
+#include <U8g2lib.h>
+typedef U8G2 DisplayBuffer;
+#endif
+
+#define QR_CODE_VERSION 2
+#define QR_CODE_MODULES (4 * QR_CODE_VERSION + 17)
+// modules are drawn as 2x2 pixels inside a light border
+#define QR_CODE_BORDER 2
+#define QR_CODE_PIXELS (2 * QR_CODE_MODULES + 2 * QR_CODE_BORDER)
+#define QR_CODE_ROW_BYTES ((QR_CODE_PIXELS + 7) / 8)
+// longer urls are encoded on every draw
+#define QR_CODE_URL_SIZE 32
+
+// identifies the screen in its view state
+enum Screen : uint8_t
+{
+    SCREEN_WEIGHT,
+    SCREEN_PROMPT_TEXT,
+    SCREEN_CENTER_TEXT,
+    SCREEN_SWITCHER,
+    SCREEN_RECIPE_SUMMARY,
+    SCREEN_RECIPE_CONFIG_WEIGHT,
+    SCREEN_RECIPE_CONFIG_RATIO,
+    SCREEN_RECIPE_INSERT_COFFEE,
+    SCREEN_RECIPE_POUR,
+    SCREEN_TEXT,
+    SCREEN_MODE_SWITCHER,
+    SCREEN_ESPRESSO_SHOT,
+    SCREEN_OPENER,
+    SCREEN_CLEAR,
+};
+
+/**
+ * @brief Draws the screens into a u8g2 buffer, independent of how the buffer gets to the display.
+ *
+ * The device renders into the SH1107 buffer, native builds into a plain framebuffer.
+ * Every screen returns true if the buffer changed and has to be sent, screens that
+ * would look the same as the last one are not drawn at all.
+ */
+class DisplayRenderer
+{
+public:
+    DisplayRenderer(DisplayBuffer &u8g) : u8g(u8g) { qrCodeUrl[0] = '\0'; };
+    bool opener(const char *version);
+    bool weight(int32_t weightMg, unsigned long time);
+    bool promptText(const char *prompt, const char *text);
+    bool centerText(const char *text, const uint8_t size);
+    bool switcher(const char *title, const uint8_t index, const uint8_t count, const char *options[]);
+    bool recipeSummary(const char *name, const char *description, const char *url);
+    bool recipeConfigCoffeeWeight(const char *header, unsigned int weightMg, unsigned int waterWeightMl);
+    bool recipeConfigRatio(const char *header, uint32_t coffee, uint32_t water);
+    bool recipeInsertCoffee(int32_t weightMg, uint32_t requiredWeightMg);
+    bool recipePour(const char *text, int32_t weightToPourMg, uint64_t timeToFinishMs, bool isPause, uint8_t pourIndex, uint8_t pours);
+    bool text(const char *text);
+    bool modeSwitcher(const char *current, const uint8_t index, const uint8_t count, float batV, float batPercentage, bool batCharging);
+    bool espressoShot(uint32_t currentTimeMs, uint32_t timeToFinishMs, int32_t currentWeightMg, uint32_t targetWeightMg, bool waiting);
+    /**
+     * @brief Clears the buffer without sending it, the next screen is always drawn.
+     */
+    bool clear();
+    const FrameSkipper &getFrames() const { return frames; };
+
+private:
+    DisplayBuffer &u8g;
+    FrameSkipper frames;
+    TextLayout layout;
+    TextWidthCache widths;
+    // url of the cached qr code and its pixels as xbm, set bits are light
+    char qrCodeUrl[QR_CODE_URL_SIZE];
+    uint8_t qrCodeBits[QR_CODE_ROW_BYTES * QR_CODE_PIXELS];
+
+    /**
+     * @brief Width of the text in the current font, cached for titles and other centered text.
+     */
+    int textWidth(const char *text);
+    void drawHCenterText(const char *text, uint8_t y);
+    void drawCenterText(const char *text);
+    int drawTitleLine(const char *title);
+    void encodeQRCode(const char *text);
+    int drawQRCode(const char *text, uint8_t posX, uint8_t posY);
+    int drawSelectedBar(uint8_t index, uint8_t size);
+    void drawTextAutoWrap(const char *text, int yTop, int xLeft, int maxWidth);
+};
\ No newline at end of file
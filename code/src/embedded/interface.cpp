@@ -5,6 +5,7 @@
 #include "interface.h"
 #include "constants.h"
 #include "button.h"
+#include "millis.h"
 
 static RotaryEncoder encoder(PIN_ENC_A, PIN_ENC_B, RotaryEncoder::LatchMode::FOUR3);
 static Button encoderButton;
@@ -22,7 +23,7 @@ void Interface::update()
     encoder.tick();
     encoderButton.update(digitalRead(PIN_ENC_BTN) == LOW);
 
-    if (lastBuzzerMillis + lastBuzzerDuration < millis())
+    if (lastBuzzerMillis + lastBuzzerDuration < now())
     {
         digitalWrite(PIN_BUZZER, LOW);
     }
@@ -76,7 +77,7 @@ bool Interface::isEncoderPressed()
 void Interface::buzzerTone(unsigned int durationMs)
 {
     digitalWrite(PIN_BUZZER, HIGH);
-    lastBuzzerMillis = millis();
+    lastBuzzerMillis = now();
     lastBuzzerDuration = durationMs;
 }
 
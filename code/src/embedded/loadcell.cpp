@@ -1,23 +1,30 @@
 #ifndef NATIVE
 
 #include <Arduino.h>
+#include <esp_timer.h>
 
 #include "constants.h"
 #include "loadcell.h"
+#include "spsc_queue.h"
+
+#define LOADCELL_QUEUE_SIZE 32
+#define LOADCELL_TASK_STACK_SIZE 2048
+#define LOADCELL_TASK_PRIORITY (configMAX_PRIORITIES - 1)
+// the arduino loop runs on core 1
+#define LOADCELL_TASK_CORE 0
+// wake up regularly in case a data ready edge was missed
+#define LOADCELL_TASK_TIMEOUT_MS 200
 
 namespace LoadCell
 {
-    void begin()
-    {
-        pinMode(PIN_HX711_SCK, OUTPUT);
-        pinMode(PIN_HX711_DAT, INPUT);
-    }
-
-    bool isReady() { return digitalRead(PIN_HX711_DAT) == LOW; }
+    static SpscQueue<Sample, LOADCELL_QUEUE_SIZE> samples;
+    static TaskHandle_t acquisitionTask = nullptr;
+    static volatile int64_t dataReadyTimestampUs = 0;
+    static volatile uint32_t droppedSamples = 0;
 
-    long read()
+    static long shiftIn()
     {
-        portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+        static portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
         portENTER_CRITICAL(&mux);
 
         // shift out bits
@@ -44,6 +51,71 @@ namespace LoadCell
         portEXIT_CRITICAL(&mux);
         return value;
     }
+
+    static void IRAM_ATTR isrDataReady()
+    {
+        dataReadyTimestampUs = esp_timer_get_time();
+
+        BaseType_t higherPriorityTaskWoken = pdFALSE;
+        vTaskNotifyGiveFromISR(acquisitionTask, &higherPriorityTaskWoken);
+        if (higherPriorityTaskWoken)
+        {
+            portYIELD_FROM_ISR();
+        }
+    }
+
+    static void acquire(void *)
+    {
+        // attach here, the interrupt is serviced on the core it was attached on
+        attachInterrupt(PIN_HX711_DAT, isrDataReady, FALLING);
+
+        for (;;)
+        {
+            bool notified = ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LOADCELL_TASK_TIMEOUT_MS)) != 0;
+
+            if (digitalRead(PIN_HX711_DAT) != LOW)
+            {
+                continue;
+            }
+            // after a timeout the edge was missed and the last timestamp belongs to the previous sample
+            int64_t timestampUs = notified ? dataReadyTimestampUs : esp_timer_get_time();
+
+            // DOUT toggles while shifting out the value, which must not trigger the interrupt
+            gpio_intr_disable((gpio_num_t)PIN_HX711_DAT);
+            Sample sample = {(uint64_t)timestampUs, shiftIn()};
+            gpio_intr_enable((gpio_num_t)PIN_HX711_DAT);
+            // drop notifications from edges during the read
+            ulTaskNotifyTake(pdTRUE, 0);
+
+            if (!samples.push(sample))
+            {
+                droppedSamples++;
+            }
+        }
+    }
+
+    void begin()
+    {
+        if (acquisitionTask != nullptr)
+        {
+            return;
+        }
+
+        pinMode(PIN_HX711_SCK, OUTPUT);
+        pinMode(PIN_HX711_DAT, INPUT);
+
+        xTaskCreatePinnedToCore(acquire, "loadcell", LOADCELL_TASK_STACK_SIZE, nullptr, LOADCELL_TASK_PRIORITY, &acquisitionTask,
+                                LOADCELL_TASK_CORE);
+    }
+
+    bool isReady() { return !samples.isEmpty(); }
+
+    Sample read()
+    {
+        Sample sample = {0, 0};
+        samples.pop(sample);
+        return sample;
+    }
 }
 
-#endif
\ No newline at end of file
+#endif
@@ -17,12 +17,18 @@
 #include "update.h"
 #include "interface.h"
 #include "battery.h"
+#include "render_scheduler.h"
+#include "kalman_weight_sensor.h"
 
 #define AVERAGING_LOOPS 100
 
 #define TAG "MAIN"
 
+#if defined(WEIGHT_KALMAN)
+KalmanWeightSensor weightSensor;
+#else
 DefaultWeightSensor weightSensor;
+#endif
 Stopwatch stopwatch;
 
 void saveScale(float scale)
@@ -35,12 +41,19 @@ void saveScale(float scale)
 }
 
 ModeScale modeDefault(weightSensor, stopwatch);
+#if defined(ESPRESSO_RLS)
+ModeEspresso modeEspresso(weightSensor, stopwatch, new Regression::RecursiveEstimator(REGRESSION_FORGETTING_FACTOR));
+#elif defined(ESPRESSO_QUADRATIC)
+ModeEspresso modeEspresso(weightSensor, stopwatch, new Regression::QuadraticApproximator(REGRESSION_BUFFER_SIZE));
+#else
 ModeEspresso modeEspresso(weightSensor, stopwatch);
-ModeCalibration modeCalibration(stopwatch, saveScale);
+#endif
+ModeCalibration modeCalibration(weightSensor, stopwatch, saveScale);
 ModeSettings modeSettings;
 ModeRecipes modeRecipes(weightSensor, RECIPES, RECIPE_COUNT);
 Mode *modes[] = {&modeDefault, &modeRecipes, &modeEspresso, &modeCalibration, &modeSettings};
 ModeManager modeManager(modes, 5);
+RenderScheduler renderScheduler;
 
 Interface::EncoderDirection encoderDirection;
 
@@ -120,16 +133,43 @@ unsigned int loops = 0;
 unsigned long lastTime = millis();
 #endif
 
+/**
+ * @brief Returns true on clicks and encoder movement since the last call.
+ */
+static bool hadInput()
+{
+  static long lastEncoderTicks = 0;
+  long encoderTicks = Interface::getEncoderTicks();
+  bool input = Interface::getEncoderClick() != ClickType::NONE || encoderTicks != lastEncoderTicks;
+  lastEncoderTicks = encoderTicks;
+  return input;
+}
+
 void loop()
 {
   Interface::update();
   weightSensor.update();
+
+  // directions are consumed by the modes, so input is detected through the ticks
+  bool input = hadInput();
   modeManager.update();
 
+  if (input)
+  {
+    renderScheduler.requestRedraw();
+  }
+  if (renderScheduler.shouldDraw())
+  {
+    modeManager.draw();
+  }
+  Display::update();
+
 #ifdef PERF
   if (loops >= AVERAGING_LOOPS)
   {
-    ESP_LOGI(TAG, "Loop time: %lu", (millis() - lastTime) / loops
+    Display::FrameCounters frames = Display::getFrameCounters();
+    ESP_LOGI(TAG, "Loop time: %lu, frames pushed: %u, skipped: %u, last frame bytes: %u, max display update: %uus",
+             (millis() - lastTime) / loops, frames.pushed, frames.skipped, frames.lastFrameBytes, frames.maxUpdateUs);
     loops = 0;
     lastTime = millis();
   }
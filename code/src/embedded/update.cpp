@@ -27,6 +27,7 @@ namespace Updater
         static char progress[32];
         sprintf(progress, UPDATER_PROGRESS, ((float)cur / (float)total) * 100);
         Display::centerText(progress, 13);
+        Display::flush();
     }
 
     void error(int err) { ESP_LOGI(TAG, "CALLBACK:  HTTP update fatal error code %d\n", err); }
@@ -37,12 +38,14 @@ namespace Updater
         static char text[64];
         sprintf(text, UPDATER_WIFI_CONNECT_MANUAL, WiFi.softAPSSID().c_str());
         Display::text(text);
+        Display::flush();
         return true;
     }
 
     void update_firmware()
     {
         Display::centerText(UPDATER_UPDATING, 13);
+        Display::flush();
         ESP_LOGI(TAG, "Updating firmware...");
 
         uint32_t id = 0;
@@ -64,6 +67,7 @@ namespace Updater
         {
             ESP_LOGI(TAG, "WiFi connected");
             Display::centerText(UPDATER_WIFI_CONNECTED, 13);
+            Display::flush();
         }
 
         delay(1000);
@@ -85,6 +89,7 @@ namespace Updater
                 selectedQualifier = numQualifiers - 1;
             }
             Display::switcher("Choose Language", selectedQualifier, numQualifiers, names);
+            Display::update();
             Interface::update();
         }
 
@@ -108,16 +113,19 @@ namespace Updater
         case HTTP_UPDATE_FAILED:
             ESP_LOGI(TAG, "HTTP_UPDATE_FAILED Error (%d): %s", httpUpdate.getLastError(), httpUpdate.getLastErrorString().c_str());
             Display::centerText(UPDATER_FAILED, 13);
+            Display::flush();
             break;
 
         case HTTP_UPDATE_NO_UPDATES:
             ESP_LOGI(TAG, "HTTP_UPDATE_NO_UPDATES");
             Display::centerText(UPDATER_NO_UPDATE, 13);
+            Display::flush();
             break;
 
         case HTTP_UPDATE_OK:
             ESP_LOGI(TAG, "HTTP_UPDATE_OK");
             Display::centerText(UPDATER_SUCCESS, 13);
+            Display::flush();
             break;
         }
 
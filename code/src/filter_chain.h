@@ -0,0 +1,386 @@
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "ring_buffer.h"
+
+/*
+ * Filters for raw load cell values, composed at compile time, e.g.
+ * FilterChain<Median<5>, Ema<2>, AdaptiveAverage<64>>. Every stage has
+ *
+ *   long process(long value, uint64_t timestampUs)
+ *
+ * returning its output for one sample, the chain feeds the output of one stage into the next.
+ * Stages are plain classes without virtual functions, so a whole chain inlines into the caller.
+ */
+
+/**
+ * @brief Defaults for stages that keep no state between resets or ignore auto averaging.
+ *
+ * Stages hide these by defining functions with the same name, there is no virtual dispatch.
+ */
+class FilterStage
+{
+public:
+    void reset(){};
+    void setAutoAveraging(unsigned long deltaChange, uint16_t samples){};
+};
+
+/**
+ * @brief Median over the last N samples, removes single sample spikes.
+ *
+ * Keeps the window sorted, so a sample costs one removal and one insertion of at most N values.
+ * Until the window is full, the median of the samples seen so far is returned, the lower one of the two
+ * middle values for an even count.
+ */
+template <uint8_t N>
+class Median : public FilterStage
+{
+    static_assert(N > 0, "Median window must not be empty");
+
+public:
+    Median() : count(0), next(0){};
+    long process(long value, uint64_t timestampUs)
+    {
+        // a single sample is its own median, also keeps gcc from warning about the unrolled loops
+        if (N == 1)
+        {
+            return value;
+        }
+        uint8_t size = count;
+        if (count == N)
+        {
+            // drop the sample that leaves the window
+            long oldest = window[next];
+            uint8_t i = 0;
+            while (sorted[i] != oldest)
+            {
+                i++;
+            }
+            for (; i + 1 < N; i++)
+            {
+                sorted[i] = sorted[i + 1];
+            }
+            size = N - 1;
+        }
+        else
+        {
+            count++;
+        }
+
+        window[next] = value;
+        next = next + 1 == N ? 0 : next + 1;
+
+        uint8_t i = size;
+        while (i > 0 && sorted[i - 1] > value)
+        {
+            sorted[i] = sorted[i - 1];
+            i--;
+        }
+        sorted[i] = value;
+        return sorted[(count - 1) / 2];
+    };
+    void reset()
+    {
+        count = 0;
+        next = 0;
+    };
+
+private:
+    long window[N];
+    long sorted[N];
+    uint8_t count;
+    uint8_t next;
+};
+
+/**
+ * @brief Median over the last N samples in O(log N) per sample, for wider windows than Median.
+ *
+ * Samples are split into a max heap of the lower half and a min heap of the upper half, the median is
+ * the top of the lower half. Once the window is full, the new sample overwrites the oldest one in place
+ * and is sifted within its heap, so no sample has to be searched for. Returns the same values as Median,
+ * which is as fast for windows below about 31 samples.
+ */
+template <uint8_t N>
+class SlidingMedian : public FilterStage
+{
+    static_assert(N > 0, "Median window must not be empty");
+
+public:
+    SlidingMedian() : count(0), next(0), sizes{0, 0} {};
+    long process(long value, uint64_t timestampUs)
+    {
+        // a single sample is its own median, also keeps gcc from warning about the unrolled heaps
+        if (N == 1)
+        {
+            return value;
+        }
+        uint8_t slot = next;
+        next = next + 1 == N ? 0 : next + 1;
+        values[slot] = value;
+
+        if (count < N)
+        {
+            count++;
+            bool upper = sizes[LOWER] > 0 && value > values[heaps[LOWER][0]];
+            place(upper, sizes[upper]++, slot);
+            siftUp(upper, position[slot]);
+            // the lower half holds the one extra sample of an odd count
+            if (sizes[LOWER] > sizes[UPPER] + 1)
+            {
+                move(LOWER);
+            }
+            else if (sizes[UPPER] > sizes[LOWER])
+            {
+                move(UPPER);
+            }
+        }
+        else
+        {
+            bool upper = inUpper[slot];
+            siftUp(upper, position[slot]);
+            siftDown(upper, position[slot]);
+            // only the replaced sample can be on the wrong side
+            if (sizes[UPPER] > 0 && values[heaps[LOWER][0]] > values[heaps[UPPER][0]])
+            {
+                uint8_t lowerTop = heaps[LOWER][0];
+                place(LOWER, 0, heaps[UPPER][0]);
+                place(UPPER, 0, lowerTop);
+                siftDown(LOWER, 0);
+                siftDown(UPPER, 0);
+            }
+        }
+        return values[heaps[LOWER][0]];
+    };
+    void reset()
+    {
+        count = 0;
+        next = 0;
+        sizes[LOWER] = 0;
+        sizes[UPPER] = 0;
+    };
+
+private:
+    static const bool LOWER = false;
+    static const bool UPPER = true;
+
+    long values[N];
+    // slots of the samples, lower half as max heap, upper half as min heap
+    uint8_t heaps[2][N];
+    uint8_t position[N];
+    bool inUpper[N];
+    uint8_t count;
+    uint8_t next;
+    uint8_t sizes[2];
+
+    void place(bool upper, uint8_t index, uint8_t slot)
+    {
+        heaps[upper][index] = slot;
+        position[slot] = index;
+        inUpper[slot] = upper;
+    };
+    /**
+     * @brief Returns true if slot a belongs closer to the top of the heap than slot b.
+     */
+    bool above(bool upper, uint8_t a, uint8_t b) const { return upper ? values[a] < values[b] : values[a] > values[b]; };
+    void siftUp(bool upper, uint8_t index)
+    {
+        uint8_t slot = heaps[upper][index];
+        while (index > 0)
+        {
+            uint8_t parent = (index - 1) / 2;
+            if (!above(upper, slot, heaps[upper][parent]))
+            {
+                break;
+            }
+            place(upper, index, heaps[upper][parent]);
+            index = parent;
+        }
+        place(upper, index, slot);
+    };
+    void siftDown(bool upper, uint8_t index)
+    {
+        uint8_t slot = heaps[upper][index];
+        uint8_t size = sizes[upper];
+        while (true)
+        {
+            uint8_t child = 2 * index + 1;
+            if (child >= size)
+            {
+                break;
+            }
+            if (child + 1 < size && above(upper, heaps[upper][child + 1], heaps[upper][child]))
+            {
+                child++;
+            }
+            if (!above(upper, heaps[upper][child], slot))
+            {
+                break;
+            }
+            place(upper, index, heaps[upper][child]);
+            index = child;
+        }
+        place(upper, index, slot);
+    };
+    /**
+     * @brief Moves the top of one half to the other one.
+     */
+    void move(bool from)
+    {
+        uint8_t slot = heaps[from][0];
+        place(from, 0, heaps[from][--sizes[from]]);
+        siftDown(from, 0);
+        place(!from, sizes[!from]++, slot);
+        siftUp(!from, position[slot]);
+    };
+};
+
+/**
+ * @brief Exponential moving average with a smoothing factor of 1 / 2^SHIFT.
+ *
+ * Integer only, the average is kept with SHIFT extra bits of precision. Starts at the first sample
+ * instead of rising from 0.
+ */
+template <uint8_t SHIFT>
+class Ema : public FilterStage
+{
+    static_assert(SHIFT < 24, "Ema shift leaves no room for the load cell value");
+
+public:
+    Ema() : accumulator(0), started(false){};
+    long process(long value, uint64_t timestampUs)
+    {
+        if (!started)
+        {
+            accumulator = static_cast<int64_t>(value) * ONE;
+            started = true;
+        }
+        // relies on arithmetic right shifts for negative values, like gcc does
+        accumulator += value - (accumulator >> SHIFT);
+        return (accumulator + ONE / 2) >> SHIFT;
+    };
+    void reset() { started = false; };
+
+private:
+    static const int64_t ONE = static_cast<int64_t>(1) << SHIFT;
+
+    int64_t accumulator;
+    bool started;
+};
+
+/**
+ * @brief Averages over up to N samples while the value changes slower than a threshold.
+ *
+ * As soon as the value changes faster, the average is dropped and the sample is passed through,
+ * so a changing weight is shown without lag. The rate is taken from the capture timestamps of two
+ * consecutive samples. Disabled until configured with setAutoAveraging.
+ */
+template <uint16_t N>
+class AdaptiveAverage : public FilterStage
+{
+public:
+    AdaptiveAverage() : samples(1), deltaPerSecond(0), lastValue(0), lastTimestampUs(0){};
+    long process(long value, uint64_t timestampUs)
+    {
+        // compares change / time < threshold without dividing
+        uint64_t change = static_cast<uint64_t>(labs(value - lastValue)) * 1000000;
+        uint64_t allowed = static_cast<uint64_t>(deltaPerSecond) * (timestampUs - lastTimestampUs);
+        lastValue = value;
+        lastTimestampUs = timestampUs;
+
+        if (change < allowed)
+        {
+            samples.push(value);
+            return samples.roundedAverage();
+        }
+        // only values read after averaging was activated are averaged, older ones would make the value jump
+        samples.clear();
+        return value;
+    };
+    void reset()
+    {
+        samples.clear();
+        lastValue = 0;
+        lastTimestampUs = 0;
+    };
+    /**
+     * @param deltaChange change per second under which samples are averaged, 0 disables averaging
+     * @param samples number of samples to average, capped at N
+     */
+    void setAutoAveraging(unsigned long deltaChange, uint16_t samples)
+    {
+        deltaPerSecond = deltaChange;
+        this->samples = StatsRingBuffer<long, N>(samples);
+    };
+
+private:
+    StatsRingBuffer<long, N> samples;
+    unsigned long deltaPerSecond;
+    long lastValue;
+    uint64_t lastTimestampUs;
+};
+
+template <typename... Stages>
+class FilterChain;
+
+template <typename Stage, typename Chain>
+struct FilterChainStage;
+
+/**
+ * @brief The empty chain passes values through.
+ */
+template <>
+class FilterChain<>
+{
+public:
+    long process(long value, uint64_t timestampUs) { return value; };
+    void reset(){};
+    void setAutoAveraging(unsigned long deltaChange, uint16_t samples){};
+};
+
+/**
+ * @brief Runs the stages in order, each stage gets the output of the previous one.
+ *
+ * Configuration calls are passed to all stages, a single stage is accessible with stage<Type>().
+ */
+template <typename First, typename... Rest>
+class FilterChain<First, Rest...>
+{
+public:
+    long process(long value, uint64_t timestampUs) { return rest.process(first.process(value, timestampUs), timestampUs); };
+    void reset()
+    {
+        first.reset();
+        rest.reset();
+    };
+    void setAutoAveraging(unsigned long deltaChange, uint16_t samples)
+    {
+        first.setAutoAveraging(deltaChange, samples);
+        rest.setAutoAveraging(deltaChange, samples);
+    };
+    /**
+     * @brief Gets the first stage of the given type.
+     */
+    template <typename Stage>
+    Stage &stage() { return FilterChainStage<Stage, FilterChain>::get(*this); };
+
+    First &head() { return first; };
+    FilterChain<Rest...> &tail() { return rest; };
+
+private:
+    First first;
+    FilterChain<Rest...> rest;
+};
+
+template <typename Stage, typename First, typename... Rest>
+struct FilterChainStage<Stage, FilterChain<First, Rest...>>
+{
+    static Stage &get(FilterChain<First, Rest...> &chain) { return FilterChainStage<Stage, FilterChain<Rest...>>::get(chain.tail()); };
+};
+
+template <typename Stage, typename... Rest>
+struct FilterChainStage<Stage, FilterChain<Stage, Rest...>>
+{
+    static Stage &get(FilterChain<Stage, Rest...> &chain) { return chain.head(); };
+};
\ No newline at end of file
@@ -1,20 +1,90 @@
-#include <math.h>
-#include <stdio.h>
+#include "formatters.h"
 
-char *formatWeight(float grams)
+char *formatUnsigned(char *buffer, uint32_t value, uint8_t minDigits)
 {
-    static char buffer[10];
-    sprintf(buffer, "%.2fg", grams);
+    char digits[10];
+    uint8_t count = 0;
+    do
+    {
+        digits[count++] = '0' + value % 10;
+        value /= 10;
+    } while (value > 0);
+
+    for (uint8_t i = count; i < minDigits; i++)
+    {
+        *buffer++ = '0';
+    }
+    while (count > 0)
+    {
+        *buffer++ = digits[--count];
+    }
+    *buffer = '\0';
     return buffer;
 }
 
-char *formatTime(unsigned long millis)
+char *formatFixed(char *buffer, int64_t value, uint8_t scale, uint8_t decimals)
 {
-    unsigned int secs = floor(millis / 1000);
-    unsigned int mins = floor(secs / 60);
-    unsigned int _millis = millis % 1000;
+    uint64_t magnitude = value < 0 ? -(uint64_t)value : value;
+    // round off the digits that are not shown, or pad the missing ones
+    uint64_t divisor = 1;
+    for (uint8_t i = decimals; i < scale; i++)
+    {
+        divisor *= 10;
+    }
+    magnitude = (magnitude + divisor / 2) / divisor;
+    for (uint8_t i = scale; i < decimals; i++)
+    {
+        magnitude *= 10;
+    }
+
+    if (value < 0 && magnitude > 0)
+    {
+        *buffer++ = '-';
+    }
+
+    // at least one digit before the point
+    char digits[24];
+    uint8_t count = 0;
+    do
+    {
+        digits[count++] = '0' + magnitude % 10;
+        magnitude /= 10;
+    } while (magnitude > 0 || count <= decimals);
+
+    while (count > 0)
+    {
+        if (count == decimals)
+        {
+            *buffer++ = '.';
+        }
+        *buffer++ = digits[--count];
+    }
+    *buffer = '\0';
+    return buffer;
+}
 
-    static char buffer[10];
-    sprintf(buffer, "%02d:%02d.%d", mins, secs % 60, _millis / 100);
+char *appendText(char *buffer, const char *text)
+{
+    while (*text)
+    {
+        *buffer++ = *text++;
+    }
+    *buffer = '\0';
     return buffer;
 }
+
+char *formatWeight(char *buffer, int32_t milligrams)
+{
+    buffer = formatFixed(buffer, milligrams, 3, 2);
+    return appendText(buffer, "g");
+}
+
+char *formatTime(char *buffer, uint32_t millis)
+{
+    uint32_t secs = millis / 1000;
+    buffer = formatUnsigned(buffer, secs / 60, 2);
+    buffer = appendText(buffer, ":");
+    buffer = formatUnsigned(buffer, secs % 60, 2);
+    buffer = appendText(buffer, ".");
+    return formatUnsigned(buffer, millis % 1000 / 100);
+}
\ No newline at end of file
@@ -1,4 +1,37 @@
 #pragma once
 
-char *formatWeight(float grams);
-char *formatTime(unsigned long millis);
\ No newline at end of file
+#include <stdint.h>
+
+// fits any single value written by the formatters, including sign, unit and terminator
+#define FORMAT_BUFFER_SIZE 24
+
+/*
+ * Formatters write into the given buffer and return a pointer to the terminator,
+ * so further text can be appended there. None of them use printf or floats.
+ */
+
+/**
+ * @brief Writes an unsigned integer, padded with leading zeros to at least minDigits.
+ */
+char *formatUnsigned(char *buffer, uint32_t value, uint8_t minDigits = 1);
+/**
+ * @brief Writes a fixed point value with the given number of decimals, rounded half away from zero.
+ *
+ * For example milligrams 12345 with scale 3 and 2 decimals become "12.35".
+ * Values that round to zero have no sign.
+ *
+ * @param scale number of decimal digits in value, i.e. value is in units of 10^-scale
+ */
+char *formatFixed(char *buffer, int64_t value, uint8_t scale, uint8_t decimals);
+/**
+ * @brief Copies text, for units and separators between formatted values.
+ */
+char *appendText(char *buffer, const char *text);
+/**
+ * @brief Writes a weight in grams with two decimals, e.g. "12.35g".
+ */
+char *formatWeight(char *buffer, int32_t milligrams);
+/**
+ * @brief Writes a duration as minutes, seconds and tenths, e.g. "01:05.3". Tenths are cut, not rounded.
+ */
+char *formatTime(char *buffer, uint32_t millis);
\ No newline at end of file
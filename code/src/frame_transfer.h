@@ -0,0 +1,80 @@
+#pragma once
+
+#include "tile_diff.h"
+
+/**
+ * @brief Streams frames to the display in chunks across loop iterations.
+ *
+ * Submitted frames are copied into a pending buffer and the tiles are sent from
+ * there, so the next frame can be drawn while the previous one is still being sent. Each step() sends the changed
+ * tiles of as many tile rows as fit into its byte budget, which bounds the time a
+ * single step blocks. Rows are visited round robin, so a frequently changing row
+ * cannot starve the others when frames are submitted faster than they are sent.
+ */
+template <uint8_t TileWidth, uint8_t TileHeight>
+class FrameTransfer
+{
+public:
+    /**
+     * @brief Replaces the pending frame, rows of a frame that was not completely sent are sent from the new one.
+     */
+    void submit(const uint8_t *buffer)
+    {
+        memcpy(pending, buffer, sizeof(pending));
+        rowsLeft = TileHeight;
+        frameBytes = 0;
+    }
+
+    /**
+     * @brief Sends changed tiles of the next rows until maxBytes are reached or the frame is done.
+     *
+     * A single row is always sent completely, so maxBytes should be at least TileWidth * TILE_BYTES.
+     *
+     * @return true if the frame is completely sent
+     */
+    template <typename Send>
+    bool step(Send send, uint16_t maxBytes)
+    {
+        bool wasBusy = rowsLeft > 0;
+        uint16_t bytes = 0;
+        while (rowsLeft > 0 && bytes < maxBytes)
+        {
+            bytes += tiles.updateRow(pending, nextRow, send);
+            nextRow = (nextRow + 1) % TileHeight;
+            rowsLeft--;
+        }
+
+        frameBytes += bytes;
+        if (wasBusy && rowsLeft == 0)
+        {
+            tiles.countFrame(frameBytes);
+        }
+        return rowsLeft == 0;
+    }
+
+    /**
+     * @brief Sends the rest of the pending frame, blocking.
+     */
+    template <typename Send>
+    void flush(Send send)
+    {
+        while (!step(send, TileDiff<TileWidth, TileHeight>::frameBytes()))
+        {
+        }
+    }
+
+    bool isBusy() const { return rowsLeft > 0; }
+    /**
+     * @brief Sends all tiles with the next frame, e.g. when the display content is unknown.
+     */
+    void invalidate() { tiles.invalidate(); }
+    uint16_t getLastFrameBytes() const { return tiles.getLastFrameBytes(); }
+    uint32_t getTotalBytes() const { return tiles.getTotalBytes(); }
+
+private:
+    uint8_t pending[TileDiff<TileWidth, TileHeight>::frameBytes()];
+    TileDiff<TileWidth, TileHeight> tiles;
+    uint8_t nextRow = 0;
+    uint8_t rowsLeft = 0;
+    uint16_t frameBytes = 0;
+};
\ No newline at end of file
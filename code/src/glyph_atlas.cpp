@@ -0,0 +1,92 @@
+#include "glyph_atlas.h"
+
+const AtlasGlyph *findAtlasGlyph(const GlyphAtlas &atlas, char character)
+{
+    // atlases only hold a handful of glyphs, a binary search is not worth it
+    for (uint8_t i = 0; i < atlas.count; i++)
+    {
+        if (atlas.glyphs[i].encoding == character)
+        {
+            return &atlas.glyphs[i];
+        }
+    }
+    return nullptr;
+}
+
+int atlasTextWidth(const GlyphAtlas &atlas, const char *text)
+{
+    int width = 0;
+    for (; *text; text++)
+    {
+        const AtlasGlyph *glyph = findAtlasGlyph(atlas, *text);
+        if (glyph != nullptr)
+        {
+            width += glyph->advance;
+        }
+    }
+    return width;
+}
+
+const GlyphAtlas *fittingAtlas(const GlyphAtlas *const *atlases, uint8_t count, const char *text, int width)
+{
+    for (uint8_t i = 0; i < count; i++)
+    {
+        if (atlasTextWidth(*atlases[i], text) <= width)
+        {
+            return atlases[i];
+        }
+    }
+    return nullptr;
+}
+
+static void orColumnByte(uint8_t *buffer, int columns, int screenHeight, int column, int y, uint8_t bits)
+{
+    if (bits != 0 && column >= 0 && column < columns)
+    {
+        buffer[column * screenHeight + screenHeight - 1 - y] |= bits;
+    }
+}
+
+static void drawGlyph(uint8_t *buffer, int screenWidth, int screenHeight, const GlyphAtlas &atlas, const AtlasGlyph &glyph, int x, int baseline)
+{
+    int columns = screenWidth / 8;
+    int rowBytes = (glyph.width + 7) / 8;
+    int left = x + glyph.xOffset;
+    // floor division, glyphs may start left of the screen
+    int firstColumn = left >= 0 ? left / 8 : -((7 - left) / 8);
+    int shift = left - firstColumn * 8;
+
+    const uint8_t *row = atlas.bits + glyph.offset;
+    int top = baseline + glyph.yOffset;
+    for (int r = 0; r < glyph.height; r++, row += rowBytes)
+    {
+        int y = top + r;
+        if (y < 0 || y >= screenHeight)
+        {
+            continue;
+        }
+        for (int b = 0; b < rowBytes; b++)
+        {
+            int column = firstColumn + b;
+            orColumnByte(buffer, columns, screenHeight, column, y, row[b] << shift);
+            if (shift != 0)
+            {
+                orColumnByte(buffer, columns, screenHeight, column + 1, y, row[b] >> (8 - shift));
+            }
+        }
+    }
+}
+
+int drawAtlasText(uint8_t *buffer, int screenWidth, int screenHeight, const GlyphAtlas &atlas, int x, int baseline, const char *text)
+{
+    for (; *text; text++)
+    {
+        const AtlasGlyph *glyph = findAtlasGlyph(atlas, *text);
+        if (glyph != nullptr)
+        {
+            drawGlyph(buffer, screenWidth, screenHeight, atlas, *glyph, x, baseline);
+            x += glyph->advance;
+        }
+    }
+    return x;
+}
\ No newline at end of file
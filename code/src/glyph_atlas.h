@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdint.h>
+
+/**
+ * @brief Placement and bitmap location of one glyph in a GlyphAtlas.
+ *
+ * The bitmap is stored row by row, each row ceil(width / 8) bytes with the leftmost pixel in the lowest bit.
+ */
+struct AtlasGlyph
+{
+    char encoding;
+    uint8_t advance;
+    uint8_t width;
+    uint8_t height;
+    int8_t xOffset;
+    // top row relative to the baseline, negative above it
+    int8_t yOffset;
+    uint16_t offset;
+};
+
+/**
+ * @brief A few glyphs of a font, pre-packed by fonts/glyph_atlas.py, sorted by encoding.
+ */
+struct GlyphAtlas
+{
+    const AtlasGlyph *glyphs;
+    uint8_t count;
+    const uint8_t *bits;
+    uint8_t ascent;
+    uint8_t descent;
+};
+
+/**
+ * @brief Returns the glyph for the character or nullptr when it is not in the atlas.
+ */
+const AtlasGlyph *findAtlasGlyph(const GlyphAtlas &atlas, char character);
+/**
+ * @brief Width of the text in pixels, characters missing in the atlas are skipped.
+ */
+int atlasTextWidth(const GlyphAtlas &atlas, const char *text);
+/**
+ * @brief Returns the first atlas the text fits into, nullptr if it is wider than width in all of them.
+ *
+ * @param atlases ordered from the largest font to the smallest one
+ */
+const GlyphAtlas *fittingAtlas(const GlyphAtlas *const *atlases, uint8_t count, const char *text, int width);
+/**
+ * @brief Ors the text into a frame buffer laid out like the SH1107 with U8G2_R1.
+ *
+ * Every byte of the buffer holds 8 horizontally adjacent pixels, leftmost in the lowest bit,
+ * and the bytes of one 8 pixel wide column run from the bottom row to the top one.
+ * Pixels outside the screen are clipped, screenWidth has to be a multiple of 8.
+ *
+ * @param x left edge of the first character
+ * @param baseline row of the baseline, descenders are drawn below it
+ * @return x after the last character
+ */
+int drawAtlasText(uint8_t *buffer, int screenWidth, int screenHeight, const GlyphAtlas &atlas, int x, int baseline, const char *text);
\ No newline at end of file
@@ -0,0 +1,118 @@
+#include <math.h>
+
+#include "kalman_weight_sensor.h"
+#include "loadcell.h"
+
+KalmanWeightSensor::KalmanWeightSensor(float measurementNoise, float processNoise)
+    : measurementNoise(measurementNoise), processNoise(processNoise)
+{
+    setScale(1);
+}
+
+void KalmanWeightSensor::begin()
+{
+    LoadCell::begin();
+}
+
+void KalmanWeightSensor::update()
+{
+    newWeight = false;
+
+    // drain all samples acquired since the last update
+    while (LoadCell::isReady())
+    {
+        LoadCell::Sample sample = LoadCell::read();
+        newWeight = true;
+
+        if (started)
+        {
+            // capture timestamps keep the model correct even if samples were queued
+            filter(sample.value, (sample.timestampUs - lastTimestampUs) / 1000000.0f);
+        }
+        else
+        {
+            restart(sample.value);
+        }
+        lastTimestampUs = sample.timestampUs;
+        lastRawWeight = sample.value;
+        publish(getLastSample());
+    }
+}
+
+void KalmanWeightSensor::restart(long rawWeight)
+{
+    started = true;
+    reference = rawWeight;
+    weight = 0;
+    flow = 0;
+    // the weight is as certain as the measurement, the flow as uncertain as after a second of changes
+    p00 = measurementVariance;
+    p01 = 0;
+    p11 = processDensity;
+}
+
+void KalmanWeightSensor::filter(long rawWeight, float dt)
+{
+    // predict with constant flow, flow changes are white noise
+    float dt2 = dt * dt;
+    weight += flow * dt;
+    p00 += dt * (2 * p01 + dt * p11) + processDensity * dt2 * dt / 3;
+    p01 += dt * p11 + processDensity * dt2 / 2;
+    p11 += processDensity * dt;
+
+    // correct with the measured weight
+    float innovation = (rawWeight - reference) - weight;
+    float innovationVariance = p00 + measurementVariance;
+    if (innovation * innovation > KALMAN_RESET_SIGMAS * KALMAN_RESET_SIGMAS * innovationVariance)
+    {
+        restart(rawWeight);
+        return;
+    }
+
+    float gainWeight = p00 / innovationVariance;
+    float gainFlow = p01 / innovationVariance;
+    weight += gainWeight * innovation;
+    flow += gainFlow * innovation;
+    p11 -= gainFlow * p01;
+    p01 -= gainWeight * p01;
+    p00 -= gainWeight * p00;
+}
+
+float KalmanWeightSensor::getRawWeight() { return reference + weight; }
+
+float KalmanWeightSensor::getWeight() { return ((reference - offset) + weight) * scale; }
+
+int32_t KalmanWeightSensor::getWeightMg() { return lroundf(getWeight() * 1000); }
+
+float KalmanWeightSensor::getFlowRate() { return flow * scale; }
+
+float KalmanWeightSensor::getLastWeight() { return (lastRawWeight - offset) * scale; }
+
+float KalmanWeightSensor::getLastUntaredWeight() { return lastRawWeight * scale; }
+
+WeightSample KalmanWeightSensor::getLastSample()
+{
+    int32_t flowMgPerS = lroundf(getFlowRate() * 1000);
+    return {lastTimestampUs,
+            lastRawWeight,
+            (int32_t)lroundf(getLastWeight() * 1000),
+            (int32_t)lroundf(getLastUntaredWeight() * 1000),
+            getWeightMg(),
+            flowMgPerS,
+            labs(flowMgPerS) < WEIGHT_STABLE_FLOW_MG_PER_S};
+}
+
+bool KalmanWeightSensor::isNewWeight() { return newWeight; }
+
+void KalmanWeightSensor::tare()
+{
+    offset = reference + (long)(weight < 0 ? weight - 0.5f : weight + 0.5f);
+}
+
+void KalmanWeightSensor::setScale(float scale)
+{
+    this->scale = scale;
+    float rawNoise = measurementNoise / scale;
+    measurementVariance = rawNoise * rawNoise;
+    processDensity = processNoise / (scale * scale);
+}
\ No newline at end of file
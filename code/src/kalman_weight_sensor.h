@@ -0,0 +1,84 @@
+#pragma once
+
+#include "stdint.h"
+#include "weight_sensor.h"
+
+// standard deviation of a single HX711 sample in grams
+#define KALMAN_MEASUREMENT_NOISE_G 0.1f
+// how quickly the flow rate is expected to change, spectral density in g^2/s^3
+#define KALMAN_PROCESS_NOISE 1.0f
+// innovations beyond this many standard deviations are steps, e.g. a cup placed on the scale
+#define KALMAN_RESET_SIGMAS 8.0f
+
+/**
+ * @brief Estimates weight and flow rate with a Kalman filter over a constant flow model.
+ *
+ * The state is weight and flow rate in raw load cell units, with a symmetric 2x2 covariance,
+ * so every sample costs a fixed handful of float operations. The estimate is kept relative to
+ * a reference value near the weight, which keeps float precision independent of the raw offset.
+ * A measurement too far off to be explained by the model restarts the filter at that measurement,
+ * so steps show up without lag.
+ */
+class KalmanWeightSensor : public WeightSensor
+{
+public:
+    /**
+     * @param measurementNoise standard deviation of a sample in grams
+     * @param processNoise spectral density of flow rate changes in g^2/s^3
+     */
+    KalmanWeightSensor(float measurementNoise = KALMAN_MEASUREMENT_NOISE_G, float processNoise = KALMAN_PROCESS_NOISE);
+    void begin() override;
+    void update() override;
+    float getWeight() override;
+    /**
+     * @brief The estimate is a float, rounded to milligrams here.
+     */
+    int32_t getWeightMg() override;
+    float getLastWeight() override;
+    float getLastUntaredWeight() override;
+    WeightSample getLastSample() override;
+    bool isNewWeight() override;
+    void tare() override;
+    /**
+     * @brief Sets the scale, the filter keeps its noise parameters in grams.
+     */
+    void setScale(float scale) override;
+    /**
+     * @brief Ignored, the filter gain already trades noise against lag from the noise parameters.
+     */
+    void setAutoAveraging(unsigned long deltaChange, uint16_t samples) override{};
+    /**
+     * @brief Gets the estimated flow rate in grams per second.
+     */
+    float getFlowRate();
+    /**
+     * @brief Gets the estimated raw load cell value, before scale and tare.
+     */
+    float getRawWeight();
+
+private:
+    float measurementNoise;
+    float processNoise;
+    float scale = 1;
+    long offset = 0;
+    bool newWeight = false;
+    long lastRawWeight = 0;
+    uint64_t lastTimestampUs = 0;
+
+    bool started = false;
+    // raw value the state is relative to
+    long reference = 0;
+    // weight and flow per second, in raw units
+    float weight = 0;
+    float flow = 0;
+    // covariance of weight and flow
+    float p00 = 0;
+    float p01 = 0;
+    float p11 = 0;
+    // noise parameters in raw units for the current scale
+    float measurementVariance = 0;
+    float processDensity = 0;
+
+    void restart(long rawWeight);
+    void filter(long rawWeight, float dt);
+};
\ No newline at end of file
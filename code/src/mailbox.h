@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * @brief Lock-free mailbox holding only the latest value, for exactly one producer and one consumer.
+ *
+ * Triple buffered: the producer always has a free slot to write and the consumer always reads a complete value.
+ * Values the consumer did not take in time are overwritten, so neither side ever waits for the other.
+ *
+ * @tparam T value type, copied on publish and take
+ */
+template <typename T>
+class Mailbox
+{
+public:
+    Mailbox() : writeIndex(0), readIndex(1), middle(2){};
+    /**
+     * @brief Replaces the latest value, only called by the producer.
+     */
+    void publish(const T &value)
+    {
+        slots[writeIndex] = value;
+        // hand the written slot to the consumer and continue with the one it left behind
+        uint8_t previous = middle.exchange(writeIndex | FRESH, std::memory_order_acq_rel);
+        writeIndex = previous & INDEX_MASK;
+    };
+    /**
+     * @brief Copies the latest value, only called by the consumer.
+     *
+     * @return false if nothing was published since the last take
+     */
+    bool take(T &value)
+    {
+        if (!(middle.load(std::memory_order_acquire) & FRESH))
+        {
+            return false;
+        }
+
+        uint8_t previous = middle.exchange(readIndex, std::memory_order_acq_rel);
+        readIndex = previous & INDEX_MASK;
+        value = slots[readIndex];
+        return true;
+    };
+    bool hasNew() const { return middle.load(std::memory_order_acquire) & FRESH; };
+
+private:
+    static const uint8_t INDEX_MASK = 0x03;
+    static const uint8_t FRESH = 0x04;
+
+    T slots[3];
+    // owned by the producer
+    uint8_t writeIndex;
+    // owned by the consumer
+    uint8_t readIndex;
+    // slot in between, with the fresh flag set when it holds an untaken value
+    std::atomic<uint8_t> middle;
+};
\ No newline at end of file
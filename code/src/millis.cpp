@@ -1,28 +1,39 @@
 #include "millis.h"
 
+uint64_t now()
+{
+    return nowUs() / 1000;
+}
+
 #ifdef NATIVE
-#include <chrono>
-#include <thread>
-#include <cstdio>
-unsigned long now()
+#include <atomic>
+
+static std::atomic<uint64_t> virtualTimeUs(VIRTUAL_CLOCK_START_US);
+
+uint64_t nowUs()
 {
-    auto now = std::chrono::system_clock::now();
-    auto time_since_epoch = now.time_since_epoch();
-    auto millis = std::chrono::duration_cast<std::chrono::milliseconds>(time_since_epoch);
-    auto count = millis.count();
-    return count;
-    // return (unsigned long)std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    return virtualTimeUs.load();
 }
 
 void sleep_for(unsigned long millis)
 {
-    std::this_thread::sleep_for(std::chrono::milliseconds(millis));
+    VirtualClock::advance(millis);
+}
+
+namespace VirtualClock
+{
+    void advanceUs(uint64_t us) { virtualTimeUs += us; }
+
+    void advance(uint64_t ms) { advanceUs(ms * 1000); }
+
+    void reset() { virtualTimeUs = VIRTUAL_CLOCK_START_US; }
 }
 #else
 #include <Arduino.h>
-unsigned long now()
+#include <esp_timer.h>
+uint64_t nowUs()
 {
-    return millis();
+    return esp_timer_get_time();
 }
 
 void sleep_for(unsigned long millis)
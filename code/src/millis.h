@@ -1,4 +1,76 @@
 #pragma once
 
-unsigned long now();
-void sleep_for(unsigned long millis);
\ No newline at end of file
+#include <stdint.h>
+
+/**
+ * @brief Monotonic time in microseconds, does not wrap.
+ *
+ * Same time base as the load cell sample timestamps. Native builds use
+ * VirtualClock instead of the real time.
+ */
+uint64_t nowUs();
+/**
+ * @brief Monotonic time in milliseconds, derived from nowUs().
+ */
+uint64_t now();
+/**
+ * @brief Blocks for the given time, native builds only advance VirtualClock.
+ */
+void sleep_for(unsigned long millis);
+
+#ifdef NATIVE
+// nonzero, as a time of 0 means "never" in some places
+#define VIRTUAL_CLOCK_START_US 1000000ULL
+
+/**
+ * @brief Simulated clock backing nowUs() in native builds.
+ *
+ * Time only moves when advanced, so tests are deterministic and long
+ * scenarios replay as fast as the code under test runs.
+ */
+namespace VirtualClock
+{
+    void advanceUs(uint64_t us);
+    void advance(uint64_t ms);
+    /**
+     * @brief Sets the time back to VIRTUAL_CLOCK_START_US.
+     */
+    void reset();
+
+    /**
+     * @brief Calls step every stepMs of virtual time for durationMs.
+     */
+    template <typename Step>
+    void runFor(Step step, uint64_t durationMs, uint64_t stepMs = 1)
+    {
+        for (uint64_t elapsed = 0; elapsed < durationMs; elapsed += stepMs)
+        {
+            step();
+            advance(stepMs);
+        }
+    }
+
+    /**
+     * @brief Calls step every stepMs of virtual time until done returns true.
+     *
+     * @return false if done did not return true within timeoutMs
+     */
+    template <typename Step, typename Condition>
+    bool runUntil(Step step, Condition done, uint64_t timeoutMs, uint64_t stepMs = 1)
+    {
+        for (uint64_t elapsed = 0;; elapsed += stepMs)
+        {
+            step();
+            if (done())
+            {
+                return true;
+            }
+            if (elapsed >= timeoutMs)
+            {
+                return false;
+            }
+            advance(stepMs);
+        }
+    }
+}
+#endif
\ No newline at end of file
@@ -4,8 +4,19 @@ class Mode
 {
 public:
     virtual ~Mode() {}
+    /**
+     * @brief Handles input and updates the state, called every loop.
+     */
     virtual void update() = 0;
+    /**
+     * @brief Draws the current state, called at the frame rate of the RenderScheduler.
+     */
+    virtual void draw() = 0;
     virtual void enter() {};
+    /**
+     * @brief Called when the mode stops getting updates, i.e. the mode switcher is opened.
+     */
+    virtual void exit() {};
     virtual bool canSwitchMode() = 0;
     virtual const char* getName() = 0;
 };
\ No newline at end of file
@@ -33,8 +33,6 @@ void ModeManager::update()
             lastPercentage = Battery::getPercentage();
         }
 
-        Display::modeSwitcher(modes[currentMode]->getName(), currentMode, modeCount, lastVoltage, lastPercentage, Battery::isCharging());
-
         if (Interface::getEncoderClick() == ClickType::SINGLE)
         {
             inModeChange = false;
@@ -45,6 +43,7 @@ void ModeManager::update()
     {
         if (Interface::getEncoderClick() == ClickType::LONG && modes[currentMode]->canSwitchMode())
         {
+            modes[currentMode]->exit();
             inModeChange = true;
         }
         else
@@ -52,4 +51,16 @@ void ModeManager::update()
             modes[currentMode]->update();
         }
     }
+}
+
+void ModeManager::draw()
+{
+    if (inModeChange)
+    {
+        Display::modeSwitcher(modes[currentMode]->getName(), currentMode, modeCount, lastVoltage, lastPercentage, Battery::isCharging());
+    }
+    else
+    {
+        modes[currentMode]->draw();
+    }
 }
\ No newline at end of file
@@ -1,3 +1,4 @@
+#include <stdint.h>
 #include "mode.h"
 #include "display.h"
 
@@ -9,6 +10,10 @@ public:
     ModeManager(Mode *modes[], const int modeCount);
     ~ModeManager(){};
     void update();
+    /**
+     * @brief Draws the mode switcher or the current mode.
+     */
+    void draw();
     void begin();
 
 private:
@@ -17,5 +22,5 @@ private:
     bool inModeChange;
     Mode **modes;
     float lastVoltage, lastPercentage;
-    long lastBatteryTime;
+    uint64_t lastBatteryTime;
 };
\ No newline at end of file
@@ -1,33 +1,42 @@
 #include "mode_calibrate.h"
 #include "logger.h"
 #include "data/localization.h"
-#include "loadcell.h"
 #include "interface.h"
 
 #define TAG "MODE-CAL"
 
-ModeCalibration::ModeCalibration(Stopwatch &stopwatch, void (*saveScaleFnc)(float))
-    : stopwatch(stopwatch),
-      calibrationStep(CalibrationStep::BEGIN), saveScaleFnc(saveScaleFnc) {}
+ModeCalibration::ModeCalibration(WeightSensor &weightSensor, Stopwatch &stopwatch, void (*saveScaleFnc)(float))
+    : weightSensor(weightSensor), stopwatch(stopwatch), saveScaleFnc(saveScaleFnc),
+      calibrationStep(CalibrationStep::BEGIN), sumMeasurements(0), numMeasurements(0), tare(0) {}
+
+// the weight sensor drains the load cell every loop, so raw values are only available from its samples
+void ModeCalibration::enter() { weightSensor.subscribe(this); }
+
+void ModeCalibration::exit() { weightSensor.unsubscribe(this); }
+
+void ModeCalibration::onSample(const WeightSample &sample)
+{
+    if (calibrationStep == CalibrationStep::BEGIN)
+    {
+        tare = sample.raw;
+    }
+    else if (calibrationStep == CalibrationStep::CALIBRATING && numMeasurements < CALIBRATION_SAMPLE_SIZE)
+    {
+        sumMeasurements += static_cast<unsigned long>(sample.raw);
+        numMeasurements++;
+    }
+}
 
 void ModeCalibration::update()
 {
-    static char buffer[20];
     float average;
-    float scale;
 
     switch (calibrationStep)
     {
     case CalibrationStep::BEGIN:
-        Display::text("Starting calibration.\nRemove all items from\nscale.\n\nClick to continue!");
         sumMeasurements = 0;
         numMeasurements = 0;
 
-        if (LoadCell::isReady())
-        {
-            tare = LoadCell::read();
-        }
-
         if (Interface::getEncoderClick() == ClickType::SINGLE)
         {
             LOGI(TAG, "Tare: %ld\n", tare);
@@ -35,20 +44,12 @@ void ModeCalibration::update()
         }
         break;
     case CalibrationStep::ADD_WEIGHT:
-        Display::text("Add weight to scale.\n\nClick to continue!");
         if (Interface::getEncoderClick() == ClickType::SINGLE)
         {
             calibrationStep = CalibrationStep::CALIBRATING;
         }
         break;
     case CalibrationStep::CALIBRATING:
-        Display::text("Calibrating...");
-        if (LoadCell::isReady())
-        {
-            sumMeasurements += static_cast<unsigned long>(LoadCell::read());
-            numMeasurements++;
-        }
-
         if (numMeasurements >= CALIBRATION_SAMPLE_SIZE)
         {
             average = static_cast<float>(sumMeasurements) / static_cast<float>(numMeasurements);
@@ -59,6 +60,24 @@ void ModeCalibration::update()
             calibrationStep = CalibrationStep::END;
         }
         break;
+    case CalibrationStep::END:
+        break;
+    }
+}
+
+void ModeCalibration::draw()
+{
+    switch (calibrationStep)
+    {
+    case CalibrationStep::BEGIN:
+        Display::text("Starting calibration.\nRemove all items from\nscale.\n\nClick to continue!");
+        break;
+    case CalibrationStep::ADD_WEIGHT:
+        Display::text("Add weight to scale.\n\nClick to continue!");
+        break;
+    case CalibrationStep::CALIBRATING:
+        Display::text("Calibrating...");
+        break;
     case CalibrationStep::END:
         static char buffer[48];
         sprintf(buffer, "Calibration complete.\nScale: %.4f", scale);
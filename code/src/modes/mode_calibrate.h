@@ -8,12 +8,19 @@
 #define DEFAULT_CALIBRATION_WEIGHT 100
 #define CALIBRATION_SAMPLE_SIZE 100
 
-class ModeCalibration : public Mode
+class ModeCalibration : public Mode, public WeightSampleSubscriber
 {
 public:
-    ModeCalibration(Stopwatch &stopwatch, void (*saveScaleFnc)(float));
-    ~ModeCalibration(){};
+    ModeCalibration(WeightSensor &weightSensor, Stopwatch &stopwatch, void (*saveScaleFnc)(float));
+    ~ModeCalibration() { weightSensor.unsubscribe(this); };
     void update();
+    void draw();
+    void enter() override;
+    void exit() override;
+    /**
+     * @brief Takes the raw value of the sample as tare or as calibration measurement, depending on the step.
+     */
+    void onSample(const WeightSample &sample) override;
     const char* getName();
     bool canSwitchMode();
 
@@ -26,6 +33,7 @@ private:
         END
     };
 
+    WeightSensor &weightSensor;
     Stopwatch &stopwatch;
     void (*saveScaleFnc)(float);
 
@@ -33,4 +41,5 @@ private:
     long sumMeasurements;
     unsigned int numMeasurements;
     long tare;
+    float scale = NAN;
 };
@@ -2,7 +2,13 @@
 #include "data/localization.h"
 #include "interface.h"
 
-void ModeEspresso::enter() { Interface::resetEncoderTicks(); }
+void ModeEspresso::enter()
+{
+    Interface::resetEncoderTicks();
+    weightSensor.subscribe(this);
+}
+
+void ModeEspresso::exit() { weightSensor.unsubscribe(this); }
 
 void ModeEspresso::update()
 {
@@ -14,7 +20,7 @@ void ModeEspresso::update()
         if (stopwatch.isRunning())
         {
             weightSensor.tare();
-            approximator.reset();
+            estimator->reset();
         }
     }
 
@@ -33,32 +39,28 @@ void ModeEspresso::update()
     {
         Interface::resetEncoderTicks();
     }
+}
 
-    // new weight must be handled for regression
-    if (weightSensor.isNewWeight())
-    {
-        handleNewWeight();
-    }
-
-    // display
+void ModeEspresso::draw()
+{
     int32_t remainingTime = lastEstimatedTime - stopwatch.getTime();
     bool waiting =
         !stopwatch.isRunning() || remainingTime < 0 || remainingTime > REGRESSION_MAX_TIME || stopwatch.getTime() < REGRESSION_GRACE_PERIOD;
 
-    Display::espressoShot(stopwatch.getTime(), remainingTime, weightSensor.getWeight() * 1000, targetWeightMg, waiting);
+    Display::espressoShot(stopwatch.getTime(), remainingTime, weightSensor.getWeightMg(), targetWeightMg, waiting);
 }
 
-void ModeEspresso::handleNewWeight()
+void ModeEspresso::onSample(const WeightSample &sample)
 {
     if (stopwatch.isRunning())
     {
-        int32_t lastWeightMg = weightSensor.getLastWeight() * 1000;
-        approximator.addPoint({(long)stopwatch.getTime(), (float)lastWeightMg});
-        lastEstimatedTime = approximator.getXAtY(targetWeightMg);
+        // use the capture time, the sample may have been queued for a while
+        estimator->addPoint({(long)stopwatch.getTimeAt(sample.timestampUs), (float)sample.weightMg});
+        lastEstimatedTime = estimator->getXAtY(targetWeightMg);
 
-        if (lastWeightMg >= targetWeightMg)
+        if (sample.weightMg >= targetWeightMg)
         {
-            stopwatch.stop();
+            stopwatch.stop(sample.timestampUs);
         }
     }
 }
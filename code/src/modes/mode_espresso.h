@@ -12,28 +12,42 @@
 #define MAX_TARGET_WEIGHT_MG 100000
 
 #define REGRESSION_BUFFER_SIZE 50
+#define REGRESSION_FORGETTING_FACTOR 0.9f
 #define REGRESSION_MAX_TIME 3 * 60 * 1000
 #define REGRESSION_GRACE_PERIOD 1000
 
-class ModeEspresso : public Mode
+class ModeEspresso : public Mode, public WeightSampleSubscriber
 {
 public:
-    ModeEspresso(WeightSensor &weightSensor, Stopwatch &stopwatch)
+    /**
+     * @param estimator estimator used to predict the end of the shot, owned by the mode.
+     * Defaults to least squares over the last REGRESSION_BUFFER_SIZE points.
+     */
+    ModeEspresso(WeightSensor &weightSensor, Stopwatch &stopwatch,
+                 Regression::Estimator *estimator = new Regression::Approximator(REGRESSION_BUFFER_SIZE))
         : weightSensor(weightSensor), stopwatch(stopwatch),
-          targetWeightMg(36 * 1000), approximator(REGRESSION_BUFFER_SIZE), lastEstimatedTime(0){};
-    ~ModeEspresso(){};
+          estimator(estimator), targetWeightMg(36 * 1000), lastEstimatedTime(0){};
+    ~ModeEspresso()
+    {
+        weightSensor.unsubscribe(this);
+        delete estimator;
+    };
     void update() override;
+    void draw() override;
     void enter() override;
+    void exit() override;
     bool canSwitchMode() override;
+    /**
+     * @brief Feeds the regression and stops the stopwatch at the capture time of the sample reaching the target.
+     */
+    void onSample(const WeightSample &sample) override;
     const char *getName() override;
 
 private:
     WeightSensor &weightSensor;
     Stopwatch &stopwatch;
 
-    Regression::Approximator approximator;
+    Regression::Estimator *estimator;
     int32_t targetWeightMg;
     long lastEstimatedTime;
-
-    void handleNewWeight();
 };
\ No newline at end of file
@@ -59,6 +59,8 @@ void ModeRecipes::update()
     recipeSteps[currentRecipeStep]->update();
 }
 
+void ModeRecipes::draw() { recipeSteps[currentRecipeStep]->draw(); }
+
 bool ModeRecipes::canSwitchMode()
 {
     return currentRecipeStep == 0;
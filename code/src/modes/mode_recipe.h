@@ -11,6 +11,7 @@ class ModeRecipes : public Mode
 public:
     ModeRecipes(WeightSensor &weightSensor, const Recipe recipes[], uint8_t recipeCount);
     void update();
+    void draw();
     const char *getName();
     bool canSwitchMode();
     uint8_t getCurrentStepIndex();
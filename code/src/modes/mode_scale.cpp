@@ -1,6 +1,7 @@
 #include "modes/mode_scale.h"
 #include "data/localization.h"
 #include "display.h"
+#include "formatters.h"
 #include "interface.h"
 #include "logger.h"
 #include "settings.h"
@@ -8,8 +9,6 @@
 
 void ModeScale::update()
 {
-    Display::display(weightSensor.getWeight(), stopwatch.getTime());
-
     if (Interface::getEncoderDirection() != Interface::EncoderDirection::NONE)
     {
         weightSensor.tare();
@@ -20,22 +19,26 @@ void ModeScale::update()
         stopwatch.toggle();
     }
 
-    if (weightSensor.isNewWeight())
+    // auto tare gets every sample pushed by the weight sensor
+    if (autoTare->shouldTare())
     {
-        autoTare->update(weightSensor.getLastUntaredWeight());
-        if (autoTare->shouldTare()) {
-            Interface::buzzerTone(100);
-            weightSensor.tare();
-        }
+        Interface::buzzerTone(100);
+        weightSensor.tare();
     }
 }
 
+void ModeScale::draw() { Display::display(weightSensor.getWeightMg(), stopwatch.getTime()); }
+
 void ModeScale::enter() {
+    weightSensor.subscribe(autoTare);
+
     // set correct values for auto tare
     autoTare->weights = Settings::getAllAutoTares();
+    char text[FORMAT_BUFFER_SIZE];
     for (auto weight : autoTare->weights)
     {
-        LOGI("Scale", "auto tare weights: %f\n", weight);
+        formatWeight(text, lroundf(weight * 1000));
+        LOGI("Scale", "auto tare weights: %s\n", text);
     }
 
     float tolerance = Settings::getFloat(Settings::AUTO_TARE_TOLERANCE);
@@ -44,9 +47,12 @@ void ModeScale::enter() {
         autoTare->tolerance = tolerance;
     }
 
-    LOGI("Scale", "auto tare tolerance: %f\n", autoTare->tolerance);
+    formatWeight(text, lroundf(autoTare->tolerance * 1000));
+    LOGI("Scale", "auto tare tolerance: %s\n", text);
 }
 
+void ModeScale::exit() { weightSensor.unsubscribe(autoTare); }
+
 bool ModeScale::canSwitchMode()
 {
     return true;
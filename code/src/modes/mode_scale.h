@@ -12,7 +12,9 @@ public:
         : weightSensor(weightSensor), stopwatch(stopwatch){};
     ~ModeScale(){};
     void enter() override;
+    void exit() override;
     void update();
+    void draw();
     bool canSwitchMode();
     const char* getName();
 
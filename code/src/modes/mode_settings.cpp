@@ -17,6 +17,20 @@ void ModeSettings::update()
     }
 }
 
+void ModeSettings::draw()
+{
+    if (modifySetting)
+    {
+        static char buffer[32];
+        sprintf(buffer, "%.1f", getEditedValue());
+        Display::centerText(buffer, 16);
+    }
+    else
+    {
+        Display::switcher(MODE_NAME_SETTINGS, selected, Settings::FLOAT_SETTING_NUM, Settings::floatSettingNames);
+    }
+}
+
 bool ModeSettings::canSwitchMode() { return !modifySetting; }
 
 const char *ModeSettings::getName() { return MODE_NAME_SETTINGS; }
@@ -38,23 +52,21 @@ void ModeSettings::updateSwitcher()
         modifySetting = true;
         Interface::resetEncoderTicks();
     }
-
-    Display::switcher(MODE_NAME_SETTINGS, selected, Settings::FLOAT_SETTING_NUM, Settings::floatSettingNames);
 }
 
-void ModeSettings::updateFloatSetting()
+float ModeSettings::getEditedValue()
 {
     float val = Settings::getFloat(static_cast<Settings::FloatSetting>(selected));
     if (isnan(val)) {
         val = 0;
     }
 
-    val += (float) Interface::getEncoderTicks() * 0.5f;
+    return val + (float) Interface::getEncoderTicks() * 0.5f;
+}
 
-    // display value
-    static char buffer[32];
-    sprintf(buffer, "%.1f", val);
-    Display::centerText(buffer, 16);
+void ModeSettings::updateFloatSetting()
+{
+    float val = getEditedValue();
 
     if (Interface::getEncoderClick() == ClickType::SINGLE)
     {
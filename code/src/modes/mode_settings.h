@@ -10,6 +10,7 @@ class ModeSettings : public Mode
 {
 public:
     void update();
+    void draw();
     void enter() {
         selected = 0;
         modifySetting = false;
@@ -19,6 +20,7 @@ public:
 private:
     void updateSwitcher();
     void updateFloatSetting();
+    float getEditedValue();
     int selected = 0;
     bool modifySetting = false;
 };
\ No newline at end of file
@@ -13,6 +13,7 @@ class RecipeStep
 public:
     virtual ~RecipeStep(){};
     virtual void update() = 0;
+    virtual void draw() = 0;
     virtual void enter(){};
     virtual void exit(){};
     virtual bool canStepForward() { return true; };
@@ -12,8 +12,7 @@ void RecipeBrewing::update()
 {
     const Pour *pour = &state.configRecipe.pours[recipePourIndex];
 
-    uint64_t remainingTimePourMs;
-    bool isPause = false;
+    isPause = false;
 
     // tare scale on rotation
     if (Interface::getEncoderDirection() != Interface::EncoderDirection::NONE)
@@ -77,6 +76,11 @@ void RecipeBrewing::update()
     {
         nextPour();
     }
+}
+
+void RecipeBrewing::draw()
+{
+    const Pour *pour = &state.configRecipe.pours[recipePourIndex];
 
     // calculate remaining weight, by adding the weight of all pours including the current one
     int32_t totalPourWeightMg = 0;
@@ -87,7 +91,7 @@ void RecipeBrewing::update()
         totalPourWeightMg += pourWeightMg;
     }
 
-    const int32_t remainingWeightMg = totalPourWeightMg - (weightSensor.getWeight() * 1000);
+    const int32_t remainingWeightMg = totalPourWeightMg - weightSensor.getWeightMg();
     Display::recipePour(pour->note, remainingWeightMg, remainingTimePourMs, isPause, recipePourIndex, state.configRecipe.poursCount);
 }
 
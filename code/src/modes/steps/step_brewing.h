@@ -8,6 +8,7 @@ class RecipeBrewing : public RecipeStep
 public:
     RecipeBrewing(RecipeStepState &state, WeightSensor &weightSensor);
     void update() override;
+    void draw() override;
     void enter() override;
     bool canStepForward() override;
     uint8_t recipePourIndex;
@@ -16,8 +17,10 @@ private:
     RecipeStepState &state;
     WeightSensor &weightSensor;
 
-    unsigned long pourStartMillis = 0;
+    uint64_t pourStartMillis = 0;
     bool pourDoneFlag;
+    uint64_t remainingTimePourMs = 0;
+    bool isPause = false;
 
     void nextPour();
 };
@@ -26,11 +26,10 @@ void RecipeConfigRatioStep::update()
 
     // adjust ratios of pours according to new ratio
     newRatio = recipeGetTotalRatio(*state.originalRecipe) + Interface::getEncoderTicks() * RATIO_ADJUST_MULTIPLIER;
-
-    // update values and display
-    Display::recipeConfigRatio(state.configRecipe.name, 1 * RECIPE_RATIO_MUL, newRatio);
 }
 
+void RecipeConfigRatioStep::draw() { Display::recipeConfigRatio(state.configRecipe.name, 1 * RECIPE_RATIO_MUL, newRatio); }
+
 void RecipeConfigRatioStep::enter()
 {
     // reset ratio to default
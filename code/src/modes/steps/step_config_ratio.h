@@ -9,6 +9,7 @@ class RecipeConfigRatioStep : public RecipeStep
 public:
     RecipeConfigRatioStep(RecipeStepState &state);
     void update() override;
+    void draw() override;
     void enter() override;
     void exit() override;
 
@@ -22,9 +22,13 @@ void RecipeConfigWeightStep::update()
         Interface::setEncoderTicks(lowerBoundTicks);
     }
 
-    // update values and display
+    // update values
     state.configRecipe.coffeeWeightMg =
         state.originalRecipe->coffeeWeightMg + Interface::getEncoderTicks() * WEIGHT_ADJUST_MULTIPLIER;
+}
+
+void RecipeConfigWeightStep::draw()
+{
     Display::recipeConfigCoffeeWeight(state.configRecipe.name, state.configRecipe.coffeeWeightMg,
                                      state.configRecipe.coffeeWeightMg *
                                          ((float)recipeGetTotalRatio(state.configRecipe) / (float)RECIPE_RATIO_MUL) / 1000);
@@ -9,6 +9,7 @@ class RecipeConfigWeightStep : public RecipeStep
 public:
     RecipeConfigWeightStep(RecipeStepState &state);
     void update() override;
+    void draw() override;
     void enter() override;
 
 private:
@@ -7,7 +7,8 @@ class RecipeDone : public RecipeStep
 {
 public:
     RecipeDone(RecipeStepState &state) : state(state){};
-    void update() override
+    void update() override {}
+    void draw() override
     {
         Display::centerText("Done!", 30);
     }
@@ -12,10 +12,10 @@ void RecipePrepare::update()
     {
         weightSensor.tare();
     }
-
-    Display::recipeInsertCoffee(weightSensor.getWeight() * 1000, state.configRecipe.coffeeWeightMg);
 }
 
+void RecipePrepare::draw() { Display::recipeInsertCoffee(weightSensor.getWeightMg(), state.configRecipe.coffeeWeightMg); }
+
 void RecipePrepare::enter()
 {
     weightSensor.tare();
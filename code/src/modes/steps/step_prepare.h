@@ -8,6 +8,7 @@ class RecipePrepare : public RecipeStep
 public:
     RecipePrepare(RecipeStepState &state, WeightSensor &weightSensor);
     void update() override;
+    void draw() override;
     void enter() override;
     void exit() override;
 private:
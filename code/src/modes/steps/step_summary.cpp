@@ -1,17 +1,10 @@
 #include "step_summary.h"
 #include "display.h"
 
-RecipeSummaryStep::RecipeSummaryStep(RecipeStepState &state) : state(state), isDisplayed(false) {}
+RecipeSummaryStep::RecipeSummaryStep(RecipeStepState &state) : state(state) {}
 
-void RecipeSummaryStep::update()
+void RecipeSummaryStep::draw()
 {
-    if (isDisplayed)
-    {
-        return;
-    }
-
+    // unchanged frames are skipped by the display, so this is cheap to repeat
     Display::recipeSummary(state.originalRecipe->name, state.originalRecipe->note, state.originalRecipe->url[0] == '\0' ? nullptr : state.originalRecipe->url);
-    isDisplayed = true;
-}
-
-void RecipeSummaryStep::enter() { isDisplayed = false; }
\ No newline at end of file
+}
\ No newline at end of file
@@ -6,10 +6,9 @@ class RecipeSummaryStep : public RecipeStep
 {
 public:
     RecipeSummaryStep(RecipeStepState &state);
-    void update() override;
-    void enter() override;
+    void update() override {}
+    void draw() override;
 
 private:
     RecipeStepState &state;
-    bool isDisplayed;
 };
@@ -34,7 +34,10 @@ void RecipeSwitcherStep::update()
     {
         recipeIndex += change;
     }
+}
 
+void RecipeSwitcherStep::draw()
+{
     Display::switcher(DISPLAY_RECIPE_SWITCHER_TITLE, recipeIndex, recipeCount, recipeSwitcherEntries);
 }
 
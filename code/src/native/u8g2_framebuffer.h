@@ -0,0 +1,91 @@
+#pragma once
+
+#include <stdio.h>
+#include <clib/u8g2.h>
+
+// the old u8g font names the screens use, defined next to the Arduino wrapper
+#ifndef u8g_font_6x10
+#define u8g_font_6x10 u8g2_font_6x10_tf
+#define u8g_font_6x12 u8g2_font_6x12_tf
+#define u8g_font_7x13 u8g2_font_7x13_tf
+#define u8g_font_9x18 u8g2_font_9x18_tf
+#define u8g_font_10x20 u8g2_font_10x20_tf
+#endif
+
+/**
+ * @brief In-memory SH1107 framebuffer for native builds, with the subset of the U8G2 interface the screens use.
+ *
+ * Forwards to the portable u8g2 C API the same way the Arduino wrapper does, only without a bus.
+ * The buffer has the same size, orientation and tile layout as on the device.
+ */
+class U8g2Framebuffer
+{
+public:
+    U8g2Framebuffer() { u8g2_Setup_sh1107_64x128_f(&u8g2, U8G2_R1, u8x8_byte_empty, u8x8_dummy_cb); };
+
+    u8g2_t *getU8g2() { return &u8g2; };
+    void clearBuffer() { u8g2_ClearBuffer(&u8g2); };
+    uint8_t *getBufferPtr() { return u8g2_GetBufferPtr(&u8g2); };
+    uint8_t getBufferTileWidth() { return u8g2_GetBufferTileWidth(&u8g2); };
+    uint8_t getBufferTileHeight() { return u8g2_GetBufferTileHeight(&u8g2); };
+
+    u8g2_uint_t getDisplayWidth() { return u8g2_GetDisplayWidth(&u8g2); };
+    u8g2_uint_t getDisplayHeight() { return u8g2_GetDisplayHeight(&u8g2); };
+    u8g2_uint_t getWidth() { return u8g2_GetDisplayWidth(&u8g2); };
+    u8g2_uint_t getHeight() { return u8g2_GetDisplayHeight(&u8g2); };
+
+    void setFont(const uint8_t *font) { u8g2_SetFont(&u8g2, font); };
+    void setFontPosBaseline() { u8g2_SetFontPosBaseline(&u8g2); };
+    void setFontPosCenter() { u8g2_SetFontPosCenter(&u8g2); };
+    void setFontDirection(uint8_t dir) { u8g2_SetFontDirection(&u8g2, dir); };
+    int8_t getAscent() { return u8g2_GetAscent(&u8g2); };
+    int8_t getDescent() { return u8g2_GetDescent(&u8g2); };
+    int8_t getFontAscent() { return u8g2_GetFontAscent(&u8g2); };
+    u8g2_uint_t getStrWidth(const char *s) { return u8g2_GetStrWidth(&u8g2, s); };
+    u8g2_uint_t getUTF8Width(const char *s) { return u8g2_GetUTF8Width(&u8g2, s); };
+
+    void setDrawColor(uint8_t color) { u8g2_SetDrawColor(&u8g2, color); };
+    u8g2_uint_t drawStr(u8g2_uint_t x, u8g2_uint_t y, const char *s) { return u8g2_DrawStr(&u8g2, x, y, s); };
+    u8g2_uint_t drawUTF8(u8g2_uint_t x, u8g2_uint_t y, const char *s) { return u8g2_DrawUTF8(&u8g2, x, y, s); };
+    u8g2_uint_t drawGlyph(u8g2_uint_t x, u8g2_uint_t y, uint16_t encoding) { return u8g2_DrawGlyph(&u8g2, x, y, encoding); };
+    void drawHLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w) { u8g2_DrawHLine(&u8g2, x, y, w); };
+    void drawVLine(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t h) { u8g2_DrawVLine(&u8g2, x, y, h); };
+    void drawBox(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h) { u8g2_DrawBox(&u8g2, x, y, w, h); };
+    void drawFrame(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h) { u8g2_DrawFrame(&u8g2, x, y, w, h); };
+    void drawXBM(u8g2_uint_t x, u8g2_uint_t y, u8g2_uint_t w, u8g2_uint_t h, const uint8_t *bitmap)
+    {
+        u8g2_DrawXBM(&u8g2, x, y, w, h, bitmap);
+    };
+
+    /**
+     * @brief Reads a pixel in screen coordinates, i.e. after the R1 rotation.
+     */
+    bool getPixel(u8g2_uint_t x, u8g2_uint_t y)
+    {
+        // R1 maps screen x to buffer rows and flips screen y into buffer columns,
+        // buffer bytes are vertical strips of 8 pixels, one tile row after the other
+        u8g2_uint_t column = u8g2_GetDisplayHeight(&u8g2) - 1 - y;
+        uint8_t byte = getBufferPtr()[(x / 8) * getBufferTileWidth() * 8 + column];
+        return byte & (1 << (x % 8));
+    };
+    /**
+     * @brief Writes the screen as plain PBM, set pixels are black.
+     */
+    void writePbm(FILE *file)
+    {
+        u8g2_uint_t width = getDisplayWidth();
+        u8g2_uint_t height = getDisplayHeight();
+        fprintf(file, "P1\n%d %d\n", width, height);
+        for (u8g2_uint_t y = 0; y < height; y++)
+        {
+            for (u8g2_uint_t x = 0; x < width; x++)
+            {
+                fputc(getPixel(x, y) ? '1' : '0', file);
+            }
+            fputc('\n', file);
+        }
+    };
+
+private:
+    u8g2_t u8g2;
+};
\ No newline at end of file
@@ -1,40 +1,81 @@
 #include "regression.h"
 
+// initial covariance of the recursive estimator, large values let the first points dominate the estimation
+#define RLS_INITIAL_COVARIANCE 1e9
+// determinant of the normalized normal equations under which the quadratic fit is not used
+#define QUADRATIC_MIN_DETERMINANT 1e-9
+
 namespace Regression
 {    
-    void Approximator::reset() { buffer.clear(); }
-
-    void Approximator::addPoint(Point p) { buffer.push(p); }
+    void Approximator::reset()
+    {
+        buffer.clear();
+        originX = 0;
+        sumX = 0;
+        sumX2 = 0;
+        sumY = 0;
+        sumXY = 0;
+    }
 
-    Result Approximator::getLeastSquares()
+    void Approximator::addPoint(Point p)
     {
-        float sumX = 0;
-        float sumY = 0;
-        float sumX2 = 0;
-        float sumXY = 0;
+        if (buffer.size() == 0)
+        {
+            originX = p.x;
+        }
+        else if (buffer.size() == buffer.capacity())
+        {
+            // remove the oldest point, which is overwritten by this one
+            Point evicted = buffer.get(0);
+            int64_t dx = evicted.x - originX;
+            sumX -= dx;
+            sumX2 -= dx * dx;
+            sumY -= evicted.y;
+            sumXY -= dx * (double)evicted.y;
+        }
+
+        int64_t dx = p.x - originX;
+        sumX += dx;
+        sumX2 += dx * dx;
+        sumY += p.y;
+        sumXY += dx * (double)p.y;
+        buffer.push(p);
+
+        moveOrigin(buffer.get(0).x);
+    }
 
-        int bufferSize = buffer.size();
-        for (int i = 0; i < bufferSize; i++)
+    void Approximator::moveOrigin(int64_t x)
+    {
+        // shift all sums so that x is the new origin
+        int64_t shift = x - originX;
+        if (shift == 0)
         {
-            Point p = buffer.get(i);
-            sumX += p.x;
-            sumY += p.y;
-            sumX2 += p.x * p.x;
-            sumXY += p.x * p.y;
+            return;
         }
 
-        float m = (bufferSize * sumXY - sumX * sumY) / (bufferSize * sumX2 - sumX * sumX);
-        float yIntercept = (sumY - m * sumX) / bufferSize;
+        int64_t n = buffer.size();
+        sumX2 += -2 * shift * sumX + n * shift * shift;
+        sumX -= n * shift;
+        sumXY -= shift * sumY;
+        originX = x;
+    }
+
+    Result Approximator::getLeastSquares()
+    {
+        double n = buffer.size();
+        double m = (n * sumXY - sumX * sumY) / (double)(buffer.size() * sumX2 - sumX * sumX);
+        double yIntercept = (sumY - m * sumX) / n;
 
         return {
-            m,
-            yIntercept,
+            (float)m,
+            // intercept relative to the window origin, moved back to x = 0
+            (float)(yIntercept - m * originX),
         };
     }
 
-    long Approximator::getXAtY(float y) { return getXAtY(y, getLeastSquares()); }
+    long Estimator::getXAtY(float y) { return getXAtY(y, getLeastSquares()); }
 
-    long Approximator::getXAtY(float y, Result res)
+    long Estimator::getXAtY(float y, Result res)
     {
         if (isnan(res.m))
         {
@@ -43,4 +84,199 @@ namespace Regression
 
         return (y - res.yIntercept) / res.m;
     }
+
+    void RecursiveEstimator::reset()
+    {
+        count = 0;
+        originX = 0;
+        m = 0;
+        b = 0;
+        p00 = RLS_INITIAL_COVARIANCE;
+        p01 = 0;
+        p11 = RLS_INITIAL_COVARIANCE;
+    }
+
+    void RecursiveEstimator::addPoint(Point p)
+    {
+        if (count == 0)
+        {
+            originX = p.x;
+        }
+        count++;
+
+        // regressor is (t, 1)
+        double t = (p.x - originX) / 1000.0;
+
+        // P * phi
+        double pPhi0 = p00 * t + p01;
+        double pPhi1 = p01 * t + p11;
+
+        double gainDenominator = forgettingFactor + t * pPhi0 + pPhi1;
+        double k0 = pPhi0 / gainDenominator;
+        double k1 = pPhi1 / gainDenominator;
+
+        double error = p.y - (m * t + b);
+        m += k0 * error;
+        b += k1 * error;
+
+        // P = (P - K * phi^T * P) / lambda, phi^T * P equals (P * phi)^T as P is symmetric
+        p00 = (p00 - k0 * pPhi0) / forgettingFactor;
+        p01 = (p01 - k0 * pPhi1) / forgettingFactor;
+        p11 = (p11 - k1 * pPhi1) / forgettingFactor;
+    }
+
+    Result RecursiveEstimator::getLeastSquares()
+    {
+        if (count < 2)
+        {
+            return {NAN, NAN};
+        }
+
+        double mPerMs = m / 1000.0;
+        return {
+            (float)mPerMs,
+            (float)(b - mPerMs * originX),
+        };
+    }
+
+    void QuadraticApproximator::reset()
+    {
+        buffer.clear();
+        originX = 0;
+        for (int i = 0; i < 5; i++)
+        {
+            sumT[i] = 0;
+        }
+        for (int i = 0; i < 3; i++)
+        {
+            sumTY[i] = 0;
+        }
+    }
+
+    void QuadraticApproximator::addSums(double t, double y, double sign)
+    {
+        double tk = sign;
+        for (int k = 0; k < 5; k++)
+        {
+            sumT[k] += tk;
+            if (k < 3)
+            {
+                sumTY[k] += tk * y;
+            }
+            tk *= t;
+        }
+    }
+
+    void QuadraticApproximator::addPoint(Point p)
+    {
+        if (buffer.size() == 0)
+        {
+            originX = p.x;
+        }
+        else if (buffer.size() == buffer.capacity())
+        {
+            // remove the oldest point, which is overwritten by this one
+            Point evicted = buffer.get(0);
+            addSums((evicted.x - originX) / 1000.0, evicted.y, -1);
+        }
+
+        addSums((p.x - originX) / 1000.0, p.y, 1);
+        buffer.push(p);
+
+        moveOrigin(buffer.get(0).x);
+    }
+
+    void QuadraticApproximator::moveOrigin(long x)
+    {
+        if (x == originX)
+        {
+            return;
+        }
+
+        // binomial expansion of sums of (t - c)^k
+        double c = (x - originX) / 1000.0;
+        double c2 = c * c;
+        double c3 = c2 * c;
+        double c4 = c3 * c;
+
+        sumT[4] += -4 * c * sumT[3] + 6 * c2 * sumT[2] - 4 * c3 * sumT[1] + c4 * sumT[0];
+        sumT[3] += -3 * c * sumT[2] + 3 * c2 * sumT[1] - c3 * sumT[0];
+        sumT[2] += -2 * c * sumT[1] + c2 * sumT[0];
+        sumT[1] += -c * sumT[0];
+
+        sumTY[2] += -2 * c * sumTY[1] + c2 * sumTY[0];
+        sumTY[1] += -c * sumTY[0];
+
+        originX = x;
+    }
+
+    Result QuadraticApproximator::getLeastSquares()
+    {
+        double n = sumT[0];
+        double mPerS = (n * sumTY[1] - sumT[1] * sumTY[0]) / (n * sumT[2] - sumT[1] * sumT[1]);
+        double yIntercept = (sumTY[0] - mPerS * sumT[1]) / n;
+
+        double m = mPerS / 1000.0;
+        return {
+            (float)m,
+            (float)(yIntercept - m * originX),
+        };
+    }
+
+    long QuadraticApproximator::getXAtY(float y)
+    {
+        if (buffer.size() < 3)
+        {
+            return getXAtY(y, getLeastSquares());
+        }
+
+        // solve normal equations | s4 s3 s2 | | a |   | ty2 |
+        //                        | s3 s2 s1 | | b | = | ty1 |
+        //                        | s2 s1 s0 | | c |   | ty0 |
+        // with cramers rule
+        const double s0 = sumT[0], s1 = sumT[1], s2 = sumT[2], s3 = sumT[3], s4 = sumT[4];
+        const double ty0 = sumTY[0], ty1 = sumTY[1], ty2 = sumTY[2];
+
+        double minor0 = s2 * s0 - s1 * s1;
+        double minor1 = s3 * s0 - s1 * s2;
+        double minor2 = s3 * s1 - s2 * s2;
+        double det = s4 * minor0 - s3 * minor1 + s2 * minor2;
+
+        // the determinant relative to the diagonal is 0 for degenerate and near 0 for ill-conditioned systems
+        if (!(fabs(det) > QUADRATIC_MIN_DETERMINANT * s4 * s2 * s0))
+        {
+            return getXAtY(y, getLeastSquares());
+        }
+
+        double a = (ty2 * minor0 - s3 * (ty1 * s0 - s1 * ty0) + s2 * (ty1 * s1 - s2 * ty0)) / det;
+        double b = (s4 * (ty1 * s0 - s1 * ty0) - ty2 * minor1 + s2 * (s3 * ty0 - ty1 * s2)) / det;
+        double c = (s4 * (s2 * ty0 - ty1 * s1) - s3 * (s3 * ty0 - ty1 * s2) + ty2 * minor2) / det;
+
+        // solve a * t^2 + b * t + (c - y) = 0 with the numerically stable form of the quadratic formula
+        double cy = c - y;
+        double discriminant = b * b - 4 * a * cy;
+        if (discriminant < 0)
+        {
+            return getXAtY(y, getLeastSquares());
+        }
+
+        double q = -0.5 * (b + (b < 0 ? -sqrt(discriminant) : sqrt(discriminant)));
+        double root0 = q / a;
+        double root1 = cy / q;
+
+        // use the crossing closest to the latest point, which can also lie slightly in the past due to noise
+        double latest = (buffer.getRelative(0).x - originX) / 1000.0;
+        double root = isfinite(root0) ? root0 : root1;
+        if (isfinite(root1) && fabs(root1 - latest) < fabs(root - latest))
+        {
+            root = root1;
+        }
+
+        if (!isfinite(root))
+        {
+            return getXAtY(y, getLeastSquares());
+        }
+
+        return originX + (long)lround(root * 1000);
+    }
 }
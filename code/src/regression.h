@@ -4,6 +4,8 @@
 
 #include "ring_buffer.h"
 
+#define REGRESSION_MAX_POINTS 512
+
 namespace Regression
 {
     struct Point
@@ -18,21 +20,126 @@ namespace Regression
         float yIntercept;
     };
 
-    class Approximator
+    /**
+     * Estimates a line through points, used to predict when a weight will be reached.
+     */
+    class Estimator
     {
     public:
-        Approximator(uint16_t bufferSize) : buffer(bufferSize) {}
-        void reset();
-        void addPoint(Point p);
+        virtual ~Estimator() {}
+        virtual void reset() = 0;
+        virtual void addPoint(Point p) = 0;
+        /**
+         * Retrieves the current estimation of the added points.
+         * @return estimation, NaN if there are not enough points
+         */
+        virtual Result getLeastSquares() = 0;
+        virtual long getXAtY(float y);
+        long getXAtY(float y, Result res);
+    };
+
+    /**
+     * Least squares approximation over a sliding window of points.
+     *
+     * The sums needed for the approximation are updated incrementally when a point is added or evicted,
+     * so adding a point and retrieving the approximation are O(1) regardless of the window size.
+     * X values are summed relative to the oldest point in the window, which keeps the sums small and
+     * exact in 64 bit integers, even for long running shots.
+     */
+    class Approximator : public Estimator
+    {
+    public:
+        /**
+         * @param bufferSize number of points used for the approximation, capped at REGRESSION_MAX_POINTS
+         */
+        Approximator(uint16_t bufferSize) : buffer(bufferSize) { reset(); }
+        void reset() override;
+        void addPoint(Point p) override;
         /**
          * Retrieves the approcimation of the given data points using least squares.
          * @return approximation
          */
-        Result getLeastSquares();
-        long getXAtY(float y);
-        long getXAtY(float y, Result res);
+        Result getLeastSquares() override;
+
+    private:
+        RingBuffer<Point, REGRESSION_MAX_POINTS> buffer;
+
+        // x of the oldest point in the window, all sums are relative to it
+        int64_t originX;
+        int64_t sumX;
+        int64_t sumX2;
+        double sumY;
+        double sumXY;
+
+        void moveOrigin(int64_t x);
+    };
+
+    /**
+     * Recursive least squares estimation with exponential forgetting.
+     *
+     * Every point updates the estimation in O(1) with constant memory. Older points are weighted down by the
+     * forgetting factor for every new point, so the estimation follows flow changes late in a shot without
+     * jumping when old points leave a fixed window. The effective memory is about 1 / (1 - forgettingFactor) points.
+     */
+    class RecursiveEstimator : public Estimator
+    {
+    public:
+        /**
+         * @param forgettingFactor weight of the previous estimation per point, in (0, 1]. 1 means no forgetting.
+         */
+        RecursiveEstimator(float forgettingFactor) : forgettingFactor(forgettingFactor) { reset(); }
+        void reset() override;
+        void addPoint(Point p) override;
+        Result getLeastSquares() override;
 
     private:
-        RingBuffer<Point> buffer;
+        double forgettingFactor;
+
+        uint32_t count;
+        // x of the first point, the estimation uses seconds relative to it
+        long originX;
+        // slope in units per second and intercept at originX
+        double m;
+        double b;
+        // covariance matrix, symmetric
+        double p00, p01, p11;
+    };
+
+    /**
+     * Least squares fit of a quadratic polynomial over a sliding window of points.
+     *
+     * Espresso flow ramps up after pre-infusion and tapers off, which a line does not capture. The normal equation
+     * sums are updated incrementally like in Approximator, so adding a point and solving are O(1).
+     * X values are summed in seconds relative to the oldest point in the window to keep the system well conditioned.
+     * getXAtY solves for the crossing closest to the latest point in closed form and falls back to the linear fit,
+     * when the quadratic fit is ill-conditioned or never reaches y.
+     */
+    class QuadraticApproximator : public Estimator
+    {
+    public:
+        /**
+         * @param bufferSize number of points used for the approximation, capped at REGRESSION_MAX_POINTS
+         */
+        QuadraticApproximator(uint16_t bufferSize) : buffer(bufferSize) { reset(); }
+        void reset() override;
+        void addPoint(Point p) override;
+        /**
+         * Retrieves the linear least squares approximation of the points in the window.
+         */
+        Result getLeastSquares() override;
+        long getXAtY(float y) override;
+        using Estimator::getXAtY;
+
+    private:
+        RingBuffer<Point, REGRESSION_MAX_POINTS> buffer;
+
+        // x of the oldest point in the window, all sums are relative to it
+        long originX;
+        // sums of t^k and t^k * y for t in seconds relative to originX
+        double sumT[5];
+        double sumTY[3];
+
+        void addSums(double t, double y, double sign);
+        void moveOrigin(long x);
     };
-}
\ No newline at end of file
+}
@@ -0,0 +1,21 @@
+#include "render_scheduler.h"
+#include "millis.h"
+
+RenderScheduler::RenderScheduler(uint8_t targetFps) { setTargetFps(targetFps); }
+
+void RenderScheduler::setTargetFps(uint8_t targetFps) { frameIntervalUs = 1000000 / (targetFps > 0 ? targetFps : 1); }
+
+void RenderScheduler::requestRedraw() { redrawRequested = true; }
+
+bool RenderScheduler::shouldDraw()
+{
+    uint64_t time = nowUs();
+    if (!redrawRequested && time - lastDrawUs < frameIntervalUs)
+    {
+        return false;
+    }
+
+    redrawRequested = false;
+    lastDrawUs = time;
+    return true;
+}
\ No newline at end of file
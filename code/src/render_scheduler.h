@@ -0,0 +1,33 @@
+#pragma once
+
+#include <stdint.h>
+
+#ifndef RENDER_TARGET_FPS
+#define RENDER_TARGET_FPS 15
+#endif
+
+/**
+ * @brief Decides when to draw a frame, independent of how often the loop runs.
+ *
+ * Frames are drawn at the target frame rate, and immediately after input so
+ * the display reacts without delay.
+ */
+class RenderScheduler
+{
+public:
+    explicit RenderScheduler(uint8_t targetFps = RENDER_TARGET_FPS);
+    void setTargetFps(uint8_t targetFps);
+    /**
+     * @brief Draws with the next call to shouldDraw(), regardless of the frame rate.
+     */
+    void requestRedraw();
+    /**
+     * @brief Returns true if a frame is due, which starts the next frame interval.
+     */
+    bool shouldDraw();
+
+private:
+    uint32_t frameIntervalUs;
+    uint64_t lastDrawUs = 0;
+    bool redrawRequested = true;
+};
\ No newline at end of file
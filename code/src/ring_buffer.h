@@ -1,51 +1,48 @@
 #pragma once
 #include <stdint.h>
 #include <cmath>
+#include <type_traits>
 
-template <typename T>
+/**
+ * @brief Heap free ring buffer with statically allocated storage.
+ *
+ * Storage for N values is part of the object, N must be a power of two so indices wrap with a mask.
+ * The buffer can be restricted to hold fewer values than N by passing a smaller buffer size.
+ *
+ * @tparam T value type
+ * @tparam N size of the storage, power of two
+ */
+template <typename T, uint16_t N>
 class RingBuffer
 {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "RingBuffer storage size must be a power of two");
+
 public:
-    ~RingBuffer()
-    {
-        delete[] buffer;
-    };
-    RingBuffer(uint8_t bufferSize) : head(0), full(false), bufferSize(bufferSize)
-    {
-        buffer = new T[bufferSize];
-    };
+    RingBuffer(uint16_t bufferSize = N) : bufferSize(bufferSize == 0 ? 1 : (bufferSize < N ? bufferSize : N)), head(0), count(0){};
+    static constexpr uint16_t maxCapacity() { return N; };
     void push(T value)
     {
         buffer[head] = value;
-        if (head + 1 == bufferSize)
-        {
-            head = 0;
-            full = true;
-        }
-        else
-        {
-            head++;
-        }
+        head = (head + 1) & MASK;
+        count += count < bufferSize;
     };
+    /**
+     * @brief Gets a value by its position in the buffer, 0 being the oldest value.
+     */
     T get(unsigned int index) const
     {
-        return buffer[index];
+        return buffer[(head - count + index) & MASK];
     };
     T getRelative(int relative) const
     {
-        int index = head + relative - 1;
-        if (index < 0)
-        {
-            index += bufferSize;
-        }
-        return buffer[index];
+        return buffer[(head + relative - 1) & MASK];
     };
     T sumLast(unsigned int count) const
     {
         T sum = 0;
-        for (int i = 0; i < count; i++)
+        for (unsigned int i = 0; i < count; i++)
         {
-            sum += getRelative(-i);
+            sum += getRelative(-static_cast<int>(i));
         }
         return sum;
     };
@@ -55,7 +52,7 @@ public:
     };
     unsigned int size() const
     {
-        return full ? bufferSize : head;
+        return count;
     };
     unsigned int capacity() const
     {
@@ -64,15 +61,15 @@ public:
     void clear()
     {
         head = 0;
-        full = false;
+        count = 0;
     };
     float varianceLast(unsigned int count) const
     {
         float mean = averageLast(count);
         float variance = 0;
-        for (int i = 0; i < count; i++)
+        for (unsigned int i = 0; i < count; i++)
         {
-            float diff = getRelative(-i) - mean;
+            float diff = getRelative(-static_cast<int>(i)) - mean;
             variance += diff * diff;
         }
         return variance / count;
@@ -80,8 +77,89 @@ public:
     float standardDeviationLast(unsigned int count) const { return std::sqrt(varianceLast(count)); };
 
 private:
-    T *buffer;
-    unsigned int bufferSize;
-    unsigned int head;
-    bool full;
+    static const uint16_t MASK = N - 1;
+
+    T buffer[N];
+    uint16_t bufferSize;
+    uint16_t head;
+    uint16_t count;
+};
+
+/**
+ * @brief Ring buffer that keeps running statistics over all values currently in the buffer.
+ *
+ * Sum and sum of squares are updated on every push by adding the new and subtracting the evicted value,
+ * so mean, variance and standard deviation of the whole buffer are available in constant time.
+ * The sums are kept relative to the first value pushed after a clear, which keeps them small and avoids
+ * cancellation when computing the variance. Integral values are accumulated exactly in 64 bit integers.
+ */
+template <typename T, uint16_t N>
+class StatsRingBuffer
+{
+public:
+    StatsRingBuffer(uint16_t bufferSize = N) : buffer(bufferSize), shift(0), sum(0), sumSquares(0){};
+    static constexpr uint16_t maxCapacity() { return N; };
+    void push(T value)
+    {
+        if (buffer.size() == 0)
+        {
+            shift = value;
+        }
+        else if (buffer.size() == buffer.capacity())
+        {
+            // the oldest value is overwritten by this push
+            Acc evicted = static_cast<Acc>(buffer.getRelative(1 - (int)buffer.capacity())) - static_cast<Acc>(shift);
+            sum -= evicted;
+            sumSquares -= evicted * evicted;
+        }
+
+        Acc shifted = static_cast<Acc>(value) - static_cast<Acc>(shift);
+        sum += shifted;
+        sumSquares += shifted * shifted;
+        buffer.push(value);
+    };
+    T getRelative(int relative) const { return buffer.getRelative(relative); };
+    unsigned int size() const { return buffer.size(); };
+    unsigned int capacity() const { return buffer.capacity(); };
+    bool isFull() const { return buffer.size() == buffer.capacity(); };
+    void clear()
+    {
+        buffer.clear();
+        sum = 0;
+        sumSquares = 0;
+    };
+    /**
+     * @brief Mean of all values in the buffer.
+     */
+    float average() const { return static_cast<double>(shift) + static_cast<double>(sum) / size(); };
+    /**
+     * @brief Mean of all values in the buffer rounded half away from zero, in integer math.
+     */
+    T roundedAverage() const
+    {
+        static_assert(std::is_integral<T>::value, "roundedAverage needs integral values");
+        Acc count = size();
+        Acc total = static_cast<Acc>(shift) * count + sum;
+        return (total >= 0 ? total + count / 2 : total - count / 2) / count;
+    };
+    /**
+     * @brief Population variance of all values in the buffer.
+     */
+    float variance() const
+    {
+        unsigned int count = size();
+        double mean = static_cast<double>(sum) / count;
+        double variance = static_cast<double>(sumSquares) / count - mean * mean;
+        // rounding can lead to tiny negative values for constant input
+        return variance > 0 ? variance : 0;
+    };
+    float standardDeviation() const { return std::sqrt(variance()); };
+
+private:
+    typedef typename std::conditional<std::is_integral<T>::value, int64_t, double>::type Acc;
+
+    RingBuffer<T, N> buffer;
+    T shift;
+    Acc sum;
+    Acc sumSquares;
 };
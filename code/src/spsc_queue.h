@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <stdint.h>
+
+/**
+ * @brief Lock-free queue for exactly one producer and one consumer with static storage.
+ *
+ * Producer and consumer can run on different cores or threads, e.g. an acquisition task feeding the main loop.
+ * Only the producer calls push and only the consumer calls pop. N must be a power of two.
+ *
+ * @tparam T value type
+ * @tparam N capacity, power of two
+ */
+template <typename T, uint16_t N>
+class SpscQueue
+{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "SpscQueue size must be a power of two");
+
+public:
+    SpscQueue() : head(0), tail(0){};
+    /**
+     * @brief Adds a value to the queue, only called by the producer.
+     *
+     * @return false if the queue is full and the value was dropped
+     */
+    bool push(const T &value)
+    {
+        uint32_t currentHead = head.load(std::memory_order_relaxed);
+        if (currentHead - tail.load(std::memory_order_acquire) == N)
+        {
+            return false;
+        }
+
+        buffer[currentHead & MASK] = value;
+        // publish the value to the consumer
+        head.store(currentHead + 1, std::memory_order_release);
+        return true;
+    };
+    /**
+     * @brief Removes the oldest value from the queue, only called by the consumer.
+     *
+     * @return false if the queue is empty
+     */
+    bool pop(T &value)
+    {
+        uint32_t currentTail = tail.load(std::memory_order_relaxed);
+        if (currentTail == head.load(std::memory_order_acquire))
+        {
+            return false;
+        }
+
+        value = buffer[currentTail & MASK];
+        // hand the slot back to the producer
+        tail.store(currentTail + 1, std::memory_order_release);
+        return true;
+    };
+    bool isEmpty() const { return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire); };
+    unsigned int size() const { return head.load(std::memory_order_acquire) - tail.load(std::memory_order_acquire); };
+    static constexpr uint16_t capacity() { return N; };
+
+private:
+    static const uint32_t MASK = N - 1;
+
+    T buffer[N];
+    std::atomic<uint32_t> head;
+    std::atomic<uint32_t> tail;
+};
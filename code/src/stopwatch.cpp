@@ -3,13 +3,18 @@
 
 void Stopwatch::start()
 {
-    startTime = now();
+    startTimeUs = nowUs();
     running = true;
 }
 
 void Stopwatch::stop()
 {
-    stopTime = now();
+    stop(nowUs());
+}
+
+void Stopwatch::stop(uint64_t timeUs)
+{
+    stopTimeUs = timeUs < startTimeUs ? startTimeUs : timeUs;
     running = false;
 }
 
@@ -27,8 +32,8 @@ void Stopwatch::toggle()
 
 void Stopwatch::reset()
 {
-    startTime = 0;
-    stopTime = 0;
+    startTimeUs = 0;
+    stopTimeUs = 0;
     running = false;
 }
 
@@ -36,14 +41,19 @@ unsigned long Stopwatch::getTime()
 {
     if (running)
     {
-        return now() - startTime;
+        return getTimeAt(nowUs());
     }
     else
     {
-        return stopTime - startTime;
+        return (stopTimeUs - startTimeUs) / 1000;
     }
 }
 
+unsigned long Stopwatch::getTimeAt(uint64_t timeUs)
+{
+    return timeUs < startTimeUs ? 0 : (timeUs - startTimeUs) / 1000;
+}
+
 bool Stopwatch::isRunning()
 {
     return running;
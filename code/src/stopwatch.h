@@ -1,16 +1,29 @@
 #pragma once
 
+#include <stdint.h>
+
 class Stopwatch
 {
     public:
         void start();
         void stop();
+        /**
+         * @brief Stops the stopwatch at the given time from nowUs(), e.g. when a sample was captured.
+         */
+        void stop(uint64_t timeUs);
         void toggle();
         void reset();
+        /**
+         * @brief Gets the elapsed time in ms.
+         */
         unsigned long getTime();
+        /**
+         * @brief Gets the elapsed time in ms at the given time from nowUs(), 0 if it was before the start.
+         */
+        unsigned long getTimeAt(uint64_t timeUs);
         bool isRunning();
     private:
-        unsigned long startTime = 0;
-        unsigned long stopTime = 0;
+        uint64_t startTimeUs = 0;
+        uint64_t stopTimeUs = 0;
         bool running = false;
 };
\ No newline at end of file
@@ -0,0 +1,195 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+#include "view_state.h"
+
+// fits the longest recipe note, longer texts are laid out on every call
+#define TEXT_LAYOUT_TEXT_SIZE 256
+// every other character a delimiter
+#define TEXT_LAYOUT_MAX_RUNS (TEXT_LAYOUT_TEXT_SIZE / 2)
+#define TEXT_WIDTH_CACHE_SIZE 8
+// titles and values, longer texts are measured on every call
+#define TEXT_WIDTH_CACHE_TEXT_SIZE 24
+
+/**
+ * @brief A piece of text drawn in one call, a word when wrapping or a whole line when splitting.
+ */
+struct TextRun
+{
+    const char *text;
+    int16_t x;
+    uint8_t line;
+};
+
+/**
+ * @brief Breaks a text into runs once and keeps them while text, font and width stay the same.
+ *
+ * Splits like strtok, repeated delimiters do not produce empty runs. All storage is inside the object,
+ * laying out or drawing a cached text never allocates.
+ */
+class TextLayout
+{
+public:
+    TextLayout() : font(nullptr), xLeft(0), maxWidth(0), delimiter('\0'), cached(false), runCount(0){};
+
+    /**
+     * @brief Lays out words left to right, starting a new line when a word would pass maxWidth.
+     *
+     * @param measure returns the width of a string in pixels in the given font
+     * @return false if the cached layout was reused
+     */
+    template <typename Measure>
+    bool wrap(const char *text, const void *font, int xLeft, int maxWidth, Measure measure)
+    {
+        if (!tokenize(text, font, xLeft, maxWidth, ' '))
+        {
+            return false;
+        }
+
+        int spaceWidth = measure(" ");
+        int x = xLeft;
+        uint8_t line = 0;
+        for (uint8_t i = 0; i < runCount; i++)
+        {
+            int width = measure(runs[i].text);
+            if (x + width > maxWidth)
+            {
+                x = xLeft;
+                line++;
+            }
+            runs[i].x = x;
+            runs[i].line = line;
+            x += width + spaceWidth;
+        }
+        return true;
+    };
+    /**
+     * @brief Puts every part of the text between delimiters on its own line.
+     *
+     * @return false if the cached layout was reused
+     */
+    bool split(const char *text, char delimiter)
+    {
+        if (!tokenize(text, nullptr, 0, 0, delimiter))
+        {
+            return false;
+        }
+
+        for (uint8_t i = 0; i < runCount; i++)
+        {
+            runs[i].x = 0;
+            runs[i].line = i;
+        }
+        return true;
+    };
+    uint8_t getRunCount() const { return runCount; };
+    const TextRun &getRun(uint8_t index) const { return runs[index]; };
+
+private:
+    char source[TEXT_LAYOUT_TEXT_SIZE];
+    // source with delimiters replaced by terminators, runs point into it
+    char tokens[TEXT_LAYOUT_TEXT_SIZE];
+    const void *font;
+    int xLeft;
+    int maxWidth;
+    char delimiter;
+    bool cached;
+    TextRun runs[TEXT_LAYOUT_MAX_RUNS];
+    uint8_t runCount;
+
+    /**
+     * @return false if the text is already laid out with these parameters
+     */
+    bool tokenize(const char *text, const void *font, int xLeft, int maxWidth, char delimiter)
+    {
+        if (text == nullptr)
+        {
+            text = "";
+        }
+        if (cached && font == this->font && xLeft == this->xLeft && maxWidth == this->maxWidth && delimiter == this->delimiter &&
+            strcmp(text, source) == 0)
+        {
+            return false;
+        }
+
+        size_t length = strlen(text);
+        if (length >= TEXT_LAYOUT_TEXT_SIZE)
+        {
+            length = TEXT_LAYOUT_TEXT_SIZE - 1;
+        }
+        memcpy(source, text, length);
+        source[length] = '\0';
+        memcpy(tokens, source, length + 1);
+        // a cut text must not be taken for the full one next time
+        cached = text[length] == '\0';
+        this->font = font;
+        this->xLeft = xLeft;
+        this->maxWidth = maxWidth;
+        this->delimiter = delimiter;
+
+        runCount = 0;
+        bool inToken = false;
+        for (size_t i = 0; i < length; i++)
+        {
+            if (tokens[i] == delimiter)
+            {
+                tokens[i] = '\0';
+                inToken = false;
+            }
+            else if (!inToken && runCount < TEXT_LAYOUT_MAX_RUNS)
+            {
+                runs[runCount++].text = &tokens[i];
+                inToken = true;
+            }
+        }
+        return true;
+    };
+};
+
+/**
+ * @brief Remembers the width of recently measured strings with their text and font.
+ *
+ * The hash of the text only selects the entry, a hit compares the stored text.
+ */
+class TextWidthCache
+{
+public:
+    template <typename Measure>
+    int width(const char *text, const void *font, Measure measure)
+    {
+        uint32_t hash = VIEW_STATE_FNV_OFFSET;
+        size_t length = 0;
+        for (const char *c = text; *c; c++, length++)
+        {
+            hash = (hash ^ static_cast<uint8_t>(*c)) * VIEW_STATE_FNV_PRIME;
+        }
+        if (length >= TEXT_WIDTH_CACHE_TEXT_SIZE)
+        {
+            return measure(text);
+        }
+
+        Entry &entry = entries[hash % TEXT_WIDTH_CACHE_SIZE];
+        if (!entry.used || entry.font != font || entry.hash != hash || strcmp(entry.text, text) != 0)
+        {
+            entry.used = true;
+            entry.font = font;
+            entry.hash = hash;
+            memcpy(entry.text, text, length + 1);
+            entry.width = measure(text);
+        }
+        return entry.width;
+    };
+
+private:
+    struct Entry
+    {
+        bool used;
+        const void *font;
+        uint32_t hash;
+        char text[TEXT_WIDTH_CACHE_TEXT_SIZE];
+        int width;
+    };
+    Entry entries[TEXT_WIDTH_CACHE_SIZE] = {};
+};
\ No newline at end of file
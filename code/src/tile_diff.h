@@ -0,0 +1,105 @@
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+
+// a tile is 8x8 pixels, one byte per column like the SSD1306/SH1107 memory
+#define TILE_BYTES 8
+
+/**
+ * @brief Finds the tiles of a u8g2 full frame buffer that changed since the last transmitted frame.
+ *
+ * Keeps a copy of the last transmitted frame with static storage.
+ *
+ * @tparam TileWidth buffer width in tiles
+ * @tparam TileHeight buffer height in tiles
+ */
+template <uint8_t TileWidth, uint8_t TileHeight>
+class TileDiff
+{
+public:
+    static constexpr uint16_t frameBytes() { return (uint16_t)TileWidth * TileHeight * TILE_BYTES; }
+
+    /**
+     * @brief Calls send(tx, ty, tw, tiles) for each horizontal run of changed tiles and remembers them as transmitted.
+     *
+     * tiles points to the tw * TILE_BYTES bytes of the run in buffer, send must write these and not another buffer.
+     *
+     * @param buffer frame buffer in u8g2 layout, tile rows of TileWidth * TILE_BYTES bytes
+     * @return number of tile bytes sent
+     */
+    template <typename Send>
+    uint16_t update(const uint8_t *buffer, Send send)
+    {
+        uint16_t bytes = 0;
+        for (uint8_t ty = 0; ty < TileHeight; ty++)
+        {
+            bytes += updateRow(buffer, ty, send);
+        }
+
+        lastFrameBytes = bytes;
+        totalBytes += bytes;
+        return bytes;
+    }
+
+    /**
+     * @brief Same as update(), but only for tile row ty and without counting a frame.
+     */
+    template <typename Send>
+    uint16_t updateRow(const uint8_t *buffer, uint8_t ty, Send send)
+    {
+        uint16_t bytes = 0;
+        uint8_t runStart = 0;
+        uint8_t runLength = 0;
+        for (uint8_t tx = 0; tx < TileWidth; tx++)
+        {
+            uint16_t offset = ((uint16_t)ty * TileWidth + tx) * TILE_BYTES;
+            if (!rowValid[ty] || memcmp(buffer + offset, lastFrame + offset, TILE_BYTES) != 0)
+            {
+                memcpy(lastFrame + offset, buffer + offset, TILE_BYTES);
+                if (runLength == 0)
+                {
+                    runStart = tx;
+                }
+                runLength++;
+            }
+            else if (runLength > 0)
+            {
+                send(runStart, ty, runLength, buffer + ((uint16_t)ty * TileWidth + runStart) * TILE_BYTES);
+                bytes += runLength * TILE_BYTES;
+                runLength = 0;
+            }
+        }
+
+        if (runLength > 0)
+        {
+            send(runStart, ty, runLength, buffer + ((uint16_t)ty * TileWidth + runStart) * TILE_BYTES);
+            bytes += runLength * TILE_BYTES;
+        }
+
+        rowValid[ty] = true;
+        return bytes;
+    }
+
+    /**
+     * @brief Counts a frame that was sent row by row with updateRow().
+     */
+    void countFrame(uint16_t bytes)
+    {
+        lastFrameBytes = bytes;
+        totalBytes += bytes;
+    }
+
+    /**
+     * @brief Sends all tiles with the next update, e.g. when the display content is unknown.
+     */
+    void invalidate() { memset(rowValid, 0, sizeof(rowValid)); }
+    uint16_t getLastFrameBytes() const { return lastFrameBytes; }
+    uint32_t getTotalBytes() const { return totalBytes; }
+
+private:
+    uint8_t lastFrame[frameBytes()];
+    bool rowValid[TileHeight] = {};
+    uint16_t lastFrameBytes = 0;
+    uint32_t totalBytes = 0;
+};
\ No newline at end of file
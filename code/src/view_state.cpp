@@ -0,0 +1,17 @@
+#include "view_state.h"
+
+bool FrameSkipper::shouldPush(const ViewState &state)
+{
+    if (valid && state.getHash() == lastHash)
+    {
+        framesSkipped++;
+        return false;
+    }
+
+    valid = true;
+    lastHash = state.getHash();
+    framesPushed++;
+    return true;
+}
+
+void FrameSkipper::invalidate() { valid = false; }
\ No newline at end of file
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define VIEW_STATE_FNV_OFFSET 2166136261u
+#define VIEW_STATE_FNV_PRIME 16777619u
+
+/**
+ * @brief Compact FNV-1a hash of everything a screen shows.
+ *
+ * Add the values that end up on the display, e.g. formatted text instead of
+ * raw floats, so frames that look the same also hash the same.
+ */
+class ViewState
+{
+public:
+    /**
+     * @param screen identifies the screen, so different screens with equal values differ
+     */
+    explicit ViewState(uint8_t screen) { add(screen); }
+
+    ViewState &add(const void *data, size_t size)
+    {
+        const uint8_t *bytes = static_cast<const uint8_t *>(data);
+        for (size_t i = 0; i < size; i++)
+        {
+            hash = (hash ^ bytes[i]) * VIEW_STATE_FNV_PRIME;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Adds a string including its terminator, nullptr is treated like an empty string.
+     */
+    ViewState &addText(const char *text)
+    {
+        if (text != nullptr)
+        {
+            while (*text)
+            {
+                hash = (hash ^ static_cast<uint8_t>(*text++)) * VIEW_STATE_FNV_PRIME;
+            }
+        }
+        hash = hash * VIEW_STATE_FNV_PRIME;
+        return *this;
+    }
+
+    template <typename T>
+    ViewState &add(T value) { return add(&value, sizeof(value)); }
+
+    uint32_t getHash() const { return hash; }
+
+private:
+    uint32_t hash = VIEW_STATE_FNV_OFFSET;
+};
+
+/**
+ * @brief Decides if a frame has to be drawn and sent, by comparing its view state to the last pushed one.
+ */
+class FrameSkipper
+{
+public:
+    /**
+     * @brief Returns false and counts a skipped frame if the state equals the last pushed frame.
+     */
+    bool shouldPush(const ViewState &state);
+    /**
+     * @brief Forces the next frame to be pushed, e.g. after drawing outside of the skipper.
+     */
+    void invalidate();
+    uint32_t getFramesPushed() const { return framesPushed; }
+    uint32_t getFramesSkipped() const { return framesSkipped; }
+
+private:
+    bool valid = false;
+    uint32_t lastHash = 0;
+    uint32_t framesPushed = 0;
+    uint32_t framesSkipped = 0;
+};
\ No newline at end of file
@@ -1,100 +1,42 @@
-#include <cmath>
-
 #include "weight_sensor.h"
-#include "millis.h"
-#include "loadcell.h"
-
-DefaultWeightSensor::~DefaultWeightSensor()
-{
-    delete ringBuffer;
-}
-
-DefaultWeightSensor::DefaultWeightSensor()
-    : ringBuffer(new RingBuffer<long>(1)) {}
 
-void DefaultWeightSensor::begin()
+bool WeightSensor::subscribe(WeightSampleSubscriber *subscriber)
 {
-    LoadCell::begin();
-}
-
-void DefaultWeightSensor::update()
-{
-    newWeight = false;
-
-    if (LoadCell::isReady())
+    for (uint8_t i = 0; i < subscriberCount; i++)
     {
-        ringBuffer->push(LoadCell::read());
-        newWeight = true;
-
-        float passedSeconds = (now() - lastWeightTime) / 1000.0;
-        lastWeightTime = now();
-
-        float deltaPerSecond = abs(ringBuffer->getRelative(0) - ringBuffer->getRelative(-1)) / passedSeconds;
-        if (deltaPerSecond < deltaPerSChange)
-        {
-            if (numAveragingActivations < ringBuffer->capacity())
-            {
-                numAveragingActivations++;
-            }
-        }
-        else
+        if (subscribers[i] == subscriber)
         {
-            numAveragingActivations = 0;
+            return true;
         }
     }
+    if (subscriberCount == WEIGHT_MAX_SUBSCRIBERS)
+    {
+        return false;
+    }
+    subscribers[subscriberCount++] = subscriber;
+    return true;
 }
 
-long DefaultWeightSensor::getRawWeight()
+void WeightSensor::unsubscribe(WeightSampleSubscriber *subscriber)
 {
-    if (numAveragingActivations > 0)
+    for (uint8_t i = 0; i < subscriberCount; i++)
     {
-        // We use only the last numAveragingActivations values,
-        // because we only want to average values after averaging was disabled,
-        // not before, because that would lead to jumping in the weight value.
-        unsigned int min;
-        if (numAveragingActivations < ringBuffer->capacity())
-        {
-            min = numAveragingActivations;
-        }
-        else
+        if (subscribers[i] == subscriber)
         {
-            min = ringBuffer->capacity();
+            // order does not matter, the last one fills the gap
+            subscribers[i] = subscribers[--subscriberCount];
+            subscribers[subscriberCount] = nullptr;
+            return;
         }
-
-        return ringBuffer->averageLast(min);
-    }
-    else
-    {
-        return ringBuffer->getRelative(0);
     }
 }
 
-float DefaultWeightSensor::getWeight()
+void WeightSensor::publish(const WeightSample &sample)
 {
-    return (getRawWeight() - offset) * scale;
-}
-
-float DefaultWeightSensor::getLastWeight() { return (ringBuffer->getRelative(0) - offset) * scale; }
-
-float DefaultWeightSensor::getLastUntaredWeight() { return ringBuffer->getRelative(0) * scale; }
-
-bool DefaultWeightSensor::isNewWeight()
-{
-    return newWeight;
-}
-
-void DefaultWeightSensor::tare()
-{
-    offset = getRawWeight();
-}
-
-void DefaultWeightSensor::setScale(float scale)
-{
-    this->scale = scale;
+    for (uint8_t i = 0; i < subscriberCount; i++)
+    {
+        subscribers[i]->onSample(sample);
+    }
 }
 
-void DefaultWeightSensor::setAutoAveraging(unsigned long deltaChange, uint8_t samples)
-{
-    this->deltaPerSChange = deltaChange;
-    this->ringBuffer = new RingBuffer<long>(samples);
-}
\ No newline at end of file
+template class FilteredWeightSensor<DefaultWeightFilter>;
\ No newline at end of file
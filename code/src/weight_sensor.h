@@ -1,7 +1,88 @@
 #pragma once
 
 #include "stdint.h"
-#include "ring_buffer.h"
+#include <math.h>
+#include "filter_chain.h"
+#include "loadcell.h"
+
+#define AVERAGING_MAX_SAMPLES 128
+// fraction bits of the fixed point scale, about as precise as the float scale it is made from
+#define WEIGHT_SCALE_SHIFT 24
+// auto tare, espresso regression and a spare one for logging
+#define WEIGHT_MAX_SUBSCRIBERS 4
+// the filtered weight is stable while it changes by less than this
+#define WEIGHT_STABLE_FLOW_MG_PER_S 1000
+
+/**
+ * @brief A single load cell sample with the time it was captured and all values derived from it.
+ *
+ * Derived once per sample by the sensor, consumers should not filter the weight again.
+ */
+struct WeightSample
+{
+    /// Capture time in microseconds, on the same clock as nowUs()
+    uint64_t timestampUs;
+    /// Raw load cell value
+    long raw;
+    /// Scaled and tared weight in milligrams, not averaged
+    int32_t weightMg;
+    /// Scaled weight in milligrams without tare, not averaged
+    int32_t untaredMg;
+    /// Scaled and tared weight in milligrams after the sensor's filter, same as getWeightMg()
+    int32_t filteredMg;
+    /// Change of the weight in milligrams per second
+    int32_t flowMgPerS;
+    /// True while the flow is below WEIGHT_STABLE_FLOW_MG_PER_S
+    bool stable;
+};
+
+/**
+ * @brief Gets every sample pushed by a WeightSensor it is subscribed to.
+ */
+class WeightSampleSubscriber
+{
+public:
+    virtual ~WeightSampleSubscriber(){};
+    /**
+     * @brief Called from WeightSensor::update for every sample, samples queued since the last update included.
+     */
+    virtual void onSample(const WeightSample &sample) = 0;
+};
+
+/**
+ * @brief Clamps a 64 bit intermediate to the int32_t range of the milligram fields.
+ */
+inline int32_t saturateInt32(int64_t value)
+{
+    return value > INT32_MAX ? INT32_MAX : (value < INT32_MIN ? INT32_MIN : static_cast<int32_t>(value));
+}
+
+/**
+ * @brief Converts raw load cell values to milligrams with integer math only.
+ *
+ * The float scale is converted to milligrams per raw value in fixed point once, when it is set.
+ * The result is an int32_t, so a full scale 24 bit load cell value only converts exactly for scales up to
+ * 0.256 grams per raw value, about 800 raw per gram is typical. Larger results saturate.
+ */
+class FixedPointScale
+{
+public:
+    FixedPointScale(float scale = 1) { set(scale); };
+    /**
+     * @param scale grams per raw value
+     */
+    void set(float scale) { mgPerRaw = llround(static_cast<double>(scale) * 1000 * (1 << WEIGHT_SCALE_SHIFT)); };
+    /**
+     * @brief Converts a raw value, rounded to the nearest milligram and saturated to the int32_t range.
+     */
+    int32_t toMg(long raw) const
+    {
+        return saturateInt32((raw * mgPerRaw + (1 << (WEIGHT_SCALE_SHIFT - 1))) >> WEIGHT_SCALE_SHIFT);
+    };
+
+private:
+    int64_t mgPerRaw;
+};
 
 class WeightSensor
 {
@@ -15,6 +96,10 @@ public:
      * @return weight in grams
      */
     virtual float getWeight() = 0;
+    /**
+     * @brief Same as getWeight in milligrams, for code that works with integer weights.
+     */
+    virtual int32_t getWeightMg() = 0;
     /**
      * @brief Gets the latest scaled weight in grams. This is not averaged.
      * 
@@ -22,6 +107,13 @@ public:
      */
     virtual float getLastWeight() = 0;
     virtual float getLastUntaredWeight() = 0;
+    /**
+     * @brief Gets the latest sample, timestamped when the load cell signaled data ready.
+     *
+     * Use the timestamp instead of the current time for anything time sensitive,
+     * as samples can be processed a while after they were captured.
+     */
+    virtual WeightSample getLastSample() = 0;
     virtual bool isNewWeight() = 0;
     virtual void tare() = 0;
     virtual void setScale(float scale) = 0;
@@ -33,38 +125,172 @@ public:
      *
      * @param deltaChange The delta change in units per second under which auto
      * averaging is enabled. Set to 0 to disable auto averaging.
-     * @param samples The number of samples to use when averaging is activated
+     * @param samples The number of samples to use when averaging is activated, capped at AVERAGING_MAX_SAMPLES
+     */
+    virtual void setAutoAveraging(unsigned long deltaChange, uint16_t samples){};
+    /**
+     * @brief Pushes every new sample to the subscriber until it unsubscribes. Subscribing twice has no effect.
+     *
+     * The subscriber table is fixed, must not be called from onSample.
+     *
+     * @return false if all WEIGHT_MAX_SUBSCRIBERS slots are taken
      */
-    virtual void setAutoAveraging(unsigned long deltaChange, uint8_t samples){};
+    bool subscribe(WeightSampleSubscriber *subscriber);
+    void unsubscribe(WeightSampleSubscriber *subscriber);
+
+protected:
+    void publish(const WeightSample &sample);
+
+private:
+    WeightSampleSubscriber *subscribers[WEIGHT_MAX_SUBSCRIBERS] = {};
+    uint8_t subscriberCount = 0;
 };
 
-class DefaultWeightSensor : public WeightSensor
+/**
+ * @brief Weight sensor reading the load cell through a filter chain fixed at compile time.
+ *
+ * The filter works on raw load cell values, tare and the fixed point scale are applied afterwards,
+ * so there is no float math per sample.
+ *
+ * @tparam Filter a FilterChain or any other type with the same functions
+ */
+template <typename Filter>
+class FilteredWeightSensor : public WeightSensor
 {
 public:
-    ~DefaultWeightSensor() override;
-    DefaultWeightSensor();
     void begin() override;
     void update() override;
     float getWeight() override;
+    int32_t getWeightMg() override;
     float getLastWeight() override;
     float getLastUntaredWeight() override;
+    WeightSample getLastSample() override;
     bool isNewWeight() override;
     void tare() override;
     void setScale(float scale) override;
-    void setAutoAveraging(unsigned long deltaChange, uint8_t samples) override;
+    /**
+     * @brief Passed to all stages of the filter, until the next sample the weight is not filtered.
+     */
+    void setAutoAveraging(unsigned long deltaChange, uint16_t samples) override;
+    /**
+     * @brief Gets the filtered raw load cell value, before scale and tare.
+     */
     long getRawWeight();
+    Filter &getFilter() { return filter; };
 
 private:
-    void updateAveraging(long lastWeight, long newWeight);
-
-    float weight = 0;
-    float scale = 1;
+    Filter filter;
+    FixedPointScale scale;
     long offset = 0;
     bool newWeight = false;
+    long filteredRawWeight = 0;
+    WeightSample lastSample = {};
+
+    /**
+     * @brief Updates the weights of the last sample after the raw values, tare or scale changed.
+     */
+    void deriveWeights();
+};
+
+template <typename Filter>
+void FilteredWeightSensor<Filter>::begin()
+{
+    LoadCell::begin();
+}
+
+template <typename Filter>
+void FilteredWeightSensor<Filter>::update()
+{
+    newWeight = false;
+
+    // drain all samples acquired since the last update
+    while (LoadCell::isReady())
+    {
+        LoadCell::Sample sample = LoadCell::read();
+        newWeight = true;
+        long lastFilteredRawWeight = filteredRawWeight;
+        filteredRawWeight = filter.process(sample.value, sample.timestampUs);
+
+        // capture timestamps keep rates correct even if samples were queued
+        uint64_t passedUs = sample.timestampUs - lastSample.timestampUs;
+        int64_t changeMg = scale.toMg(filteredRawWeight - lastFilteredRawWeight);
+        // closely spaced timestamps can give flows beyond the int32_t range
+        int64_t flowMgPerS = passedUs > 0 ? changeMg * 1000000 / static_cast<int64_t>(passedUs) : 0;
+        lastSample.flowMgPerS = saturateInt32(flowMgPerS);
+        lastSample.stable = llabs(flowMgPerS) < WEIGHT_STABLE_FLOW_MG_PER_S;
+        lastSample.timestampUs = sample.timestampUs;
+        lastSample.raw = sample.value;
+        deriveWeights();
+        publish(lastSample);
+    }
+}
+
+template <typename Filter>
+void FilteredWeightSensor<Filter>::deriveWeights()
+{
+    lastSample.weightMg = scale.toMg(lastSample.raw - offset);
+    lastSample.untaredMg = scale.toMg(lastSample.raw);
+    lastSample.filteredMg = scale.toMg(filteredRawWeight - offset);
+}
 
-    RingBuffer<long> *ringBuffer = nullptr;
-    unsigned long deltaPerSChange = 0;
-    uint8_t samples = 0;
-    unsigned long lastWeightTime = 0;
-    unsigned int numAveragingActivations = 0;
+template <typename Filter>
+long FilteredWeightSensor<Filter>::getRawWeight() { return filteredRawWeight; }
+
+template <typename Filter>
+float FilteredWeightSensor<Filter>::getWeight() { return getWeightMg() / 1000.0f; }
+
+template <typename Filter>
+int32_t FilteredWeightSensor<Filter>::getWeightMg() { return lastSample.filteredMg; }
+
+template <typename Filter>
+float FilteredWeightSensor<Filter>::getLastWeight() { return lastSample.weightMg / 1000.0f; }
+
+template <typename Filter>
+float FilteredWeightSensor<Filter>::getLastUntaredWeight() { return lastSample.untaredMg / 1000.0f; }
+
+template <typename Filter>
+WeightSample FilteredWeightSensor<Filter>::getLastSample() { return lastSample; }
+
+template <typename Filter>
+bool FilteredWeightSensor<Filter>::isNewWeight() { return newWeight; }
+
+template <typename Filter>
+void FilteredWeightSensor<Filter>::tare()
+{
+    offset = filteredRawWeight;
+    deriveWeights();
+}
+
+template <typename Filter>
+void FilteredWeightSensor<Filter>::setScale(float scale)
+{
+    this->scale.set(scale);
+    deriveWeights();
+}
+
+template <typename Filter>
+void FilteredWeightSensor<Filter>::setAutoAveraging(unsigned long deltaChange, uint16_t samples)
+{
+    filter.setAutoAveraging(deltaChange, samples);
+    filteredRawWeight = lastSample.raw;
+    deriveWeights();
+}
+
+#if defined(WEIGHT_MEDIAN_WINDOW)
+/**
+ * @brief Rejects single sample spikes, e.g. knocks on the counter, before averaging automatically.
+ */
+typedef FilterChain<SlidingMedian<WEIGHT_MEDIAN_WINDOW>, AdaptiveAverage<AVERAGING_MAX_SAMPLES>> DefaultWeightFilter;
+#else
+/**
+ * @brief Averages automatically while the weight is stable, see setAutoAveraging.
+ */
+typedef FilterChain<AdaptiveAverage<AVERAGING_MAX_SAMPLES>> DefaultWeightFilter;
+#endif
+
+// compiled once in weight_sensor.cpp
+extern template class FilteredWeightSensor<DefaultWeightFilter>;
+
+class DefaultWeightSensor : public FilteredWeightSensor<DefaultWeightFilter>
+{
 };
\ No newline at end of file
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <chrono>
+#include <cstdio>
+
+/**
+ * @brief Keeps the compiler from optimizing away a value computed in a benchmark.
+ */
+template <typename T>
+inline void benchmarkKeep(const T &value)
+{
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Runs fnc(i) for i in [0, iterations) and returns the mean duration of a single call in ns.
+ *
+ * Uses the host clock directly, benchmarks measure real time even when the firmware clock is simulated.
+ */
+template <typename F>
+double benchmarkNs(unsigned long iterations, F fnc)
+{
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned long i = 0; i < iterations; i++)
+    {
+        fnc(i);
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / iterations;
+}
+
+inline void benchmarkReport(const char *name, double ns)
+{
+    printf("BENCH %-48s %10.2f ns\n", name, ns);
+}
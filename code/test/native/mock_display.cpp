@@ -1,33 +1,48 @@
 #include <string.h>
 
 #include "mock/mock_display.h"
+#include "millis.h"
 
 namespace Display
 {
-    void begin() {}
-    void update() {}
-    void display(float weight, unsigned long time)
+    static void record(const char *function)
     {
-        Display::weight = weight;
+        if (recordCalls)
+        {
+            calls.push_back({nowUs(), function});
+        }
+    }
+
+    void begin() { record(__func__); }
+    void update() { record(__func__); }
+    void flush() { record(__func__); }
+    void display(int32_t weightMg, unsigned long time)
+    {
+        record(__func__);
+        Display::weightMg = weightMg;
         Display::time = time;
     };
-    void promptText(const char *prompt, const char *subtext) {};
+    void promptText(const char *prompt, const char *subtext) { record(__func__); };
     void centerText(const char *text, const uint8_t size)
     {
+        record(__func__);
         delete[] lastCenterText;
         lastCenterText = strdup(text);
     };
     void modeSwitcher(const char *current, const uint8_t index, const uint8_t count, float batV, float batPercentage, bool batCharging)
     {
+        record(__func__);
         lastModeText = strdup(current);
     };
     void switcher(const char *title, const uint8_t index, const uint8_t count, const char *options[])
     {
+        record(__func__);
         switcherIndex = index;
         switcherCount = count;
     };
     void recipeSummary(const char *name, const char *description, const char *url)
     {
+        record(__func__);
         delete[] recipeName;
         delete[] recipeDescription;
         recipeName = strdup(name);
@@ -35,6 +50,7 @@ namespace Display
     };
     void recipeConfigCoffeeWeight(const char *header, unsigned int weightMg, unsigned int waterWeightMl)
     {
+        record(__func__);
         weightConfigWeightMg = weightMg;
         weightConfigWaterWeightMl = waterWeightMl;
         delete weightConfigHeader;
@@ -42,32 +58,42 @@ namespace Display
     };
     void recipeConfigRatio(const char *header, uint32_t coffee, uint32_t water)
     {
+        record(__func__);
         ratioCoffee = coffee;
         ratioWater = water;
     };
     void recipeInsertCoffee(int32_t weightMg, uint32_t requiredWeightMg)
     {
+        record(__func__);
         recipeInsertWeightMg = weightMg;
         recipeInsertRequiredWeightMg = requiredWeightMg;
     };
     void recipePour(const char *text, int32_t weightToPour, uint64_t timeToFinish, bool isPause, uint8_t pourIndex, uint8_t pours)
     {
+        record(__func__);
         recipeWeightToPourMg = weightToPour;
         recipeTimeToFinishMs = timeToFinish;
         recipeIsPause = isPause;
     };
     void espressoShot(uint32_t currentTimeMs, uint32_t timeToFinishMs, int32_t currentWeightMg, uint32_t targetWeightMg, bool waiting)
     {
+        record(__func__);
         espressoCurrentTimeMs = currentTimeMs;
         espressoTimeToFinishMs = timeToFinishMs;
         espressoCurrentWeightMg = currentWeightMg;
         espressoTargetWeightMg = targetWeightMg;
     };
-    void text(const char *text) {};
-    void drawTextAutoWrap(const char *text, int yTop) {};
+    void text(const char *text) { record(__func__); };
+    void drawTextAutoWrap(const char *text, int yTop) { record(__func__); };
+    FrameCounters getFrameCounters()
+    {
+        record(__func__);
+        return {0, 0, 0, 0, 0};
+    }
     void clear()
     {
-        weight = NAN;
+        record(__func__);
+        weightMg = INT32_MIN;
         time = -1;
     };
 }
\ No newline at end of file
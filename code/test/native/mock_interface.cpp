@@ -6,6 +6,7 @@ namespace Interface
     ClickType bootClick = ClickType::NONE;
     int encoderTicks = 0;
     EncoderDirection encoderDirection = EncoderDirection::NONE;
+    unsigned int buzzerToneCount = 0;
 
     void reset()
     {
@@ -13,6 +14,7 @@ namespace Interface
         bootClick = ClickType::NONE;
         encoderTicks = 0;
         encoderDirection = EncoderDirection::NONE;
+        buzzerToneCount = 0;
     }
 
     void update() {}
@@ -28,5 +30,5 @@ namespace Interface
     EncoderDirection getEncoderDirection() { return encoderDirection; }
     void setEncoderTicks(long ticks) { encoderTicks = ticks; }
     ClickType getBootClick() { return bootClick; }
-    void buzzerTone(unsigned int durationMs) {}
+    void buzzerTone(unsigned int durationMs) { buzzerToneCount++; }
 }
\ No newline at end of file
@@ -1,13 +1,20 @@
 #include "mock/mock_loadcell.h"
+#include "millis.h"
 
 namespace LoadCell
 {
     bool ready = true;
     long value = 0L;
+    uint64_t timestampUs = 0;
 
     void begin() {}
 
     bool isReady() { return ready; }
 
-    long read() { return value; }
+    Sample read()
+    {
+        // like the HX711, a value can only be read once
+        ready = false;
+        return {timestampUs ? timestampUs : nowUs(), value};
+    }
 }
@@ -2,9 +2,11 @@
 
 namespace Settings
 {
-    float getFloat(FloatSetting s) { return 0.0f; }
+    static float values[FLOAT_SETTING_NUM] = {};
 
-    void setFloat(FloatSetting s, float value) {}
+    float getFloat(FloatSetting s) { return values[s]; }
+
+    void setFloat(FloatSetting s, float value) { values[s] = value; }
 
     void commit() {}
 }
@@ -0,0 +1,59 @@
+#include <unity.h>
+
+#include "../bench.h"
+#include "display_renderer.h"
+
+#define ITERATIONS 2000
+
+U8g2Framebuffer framebuffer;
+DisplayRenderer renderer(framebuffer);
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+/**
+ * Measures a full draw of the screen, the clear before each call keeps the view state from skipping it.
+ */
+template <typename F>
+static void benchmarkScreen(const char *name, F draw)
+{
+    double ns = benchmarkNs(ITERATIONS, [&](unsigned long i) {
+        renderer.clear();
+        benchmarkKeep(draw(i));
+    });
+    benchmarkReport(name, ns);
+}
+
+void test_bench_screens(void)
+{
+    const char *options[] = {"Scale", "Recipes", "Espresso", "Calibrate", "Settings", "Update"};
+
+    benchmarkScreen("opener", [](unsigned long) { return renderer.opener("1.2.3"); });
+    benchmarkScreen("display", [](unsigned long i) { return renderer.weight(i * 100, i * 100); });
+    benchmarkScreen("promptText", [](unsigned long) { return renderer.promptText("Prompt", "Some text"); });
+    benchmarkScreen("centerText", [](unsigned long) { return renderer.centerText("Done!", 16); });
+    benchmarkScreen("switcher", [&](unsigned long i) { return renderer.switcher("Title", i % 6, 6, options); });
+    benchmarkScreen("recipeSummary", [](unsigned long) {
+        return renderer.recipeSummary("Aeropress", "A recipe with a long description that wraps over several lines.", nullptr);
+    });
+    benchmarkScreen("recipeSummary qr code", [](unsigned long) {
+        return renderer.recipeSummary("Aeropress", "Scan for the video.", "youtu.be/j6VlT_jUVPc");
+    });
+    benchmarkScreen("recipeConfigCoffeeWeight", [](unsigned long i) { return renderer.recipeConfigCoffeeWeight("Aeropress", i * 100, 200); });
+    benchmarkScreen("recipeConfigRatio", [](unsigned long i) { return renderer.recipeConfigRatio("Aeropress", 10, i % 200); });
+    benchmarkScreen("recipeInsertCoffee", [](unsigned long i) { return renderer.recipeInsertCoffee(i * 10, 12000); });
+    benchmarkScreen("recipePour", [](unsigned long i) {
+        return renderer.recipePour("Pour water in a spiral, then stir three times.", -120000 + i * 10, 75000 - i, false, 1, 3);
+    });
+    benchmarkScreen("text", [](unsigned long) { return renderer.text("Add weight to scale.\n\nClick to continue!"); });
+    benchmarkScreen("modeSwitcher", [](unsigned long i) { return renderer.modeSwitcher("Recipes", i % 5, 5, 3.92, 80, false); });
+    benchmarkScreen("espressoShot", [](unsigned long i) { return renderer.espressoShot(i * 10, 6200, i * 20, 36000, false); });
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_screens);
+    return UNITY_END();
+}
\ No newline at end of file
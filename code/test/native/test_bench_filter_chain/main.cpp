@@ -0,0 +1,97 @@
+#include <unity.h>
+#include <stdlib.h>
+
+#include "../bench.h"
+#include "filter_chain.h"
+
+#define ITERATIONS 2000000
+// 80 samples per second
+#define SAMPLE_INTERVAL_US 12500
+
+/**
+ * The auto averaging that was hard coded in DefaultWeightSensor before, kept as benchmark baseline.
+ */
+class LegacyAutoAveraging
+{
+public:
+    LegacyAutoAveraging() : averagingBuffer(64), deltaPerSChange(1000), lastRawWeight(0), lastTimestampUs(0){};
+    long process(long rawWeight, uint64_t timestampUs)
+    {
+        float passedSeconds = (timestampUs - lastTimestampUs) / 1000000.0;
+        lastTimestampUs = timestampUs;
+
+        float deltaPerSecond = abs(rawWeight - lastRawWeight) / passedSeconds;
+        lastRawWeight = rawWeight;
+
+        if (deltaPerSecond < deltaPerSChange)
+        {
+            averagingBuffer.push(rawWeight);
+        }
+        else
+        {
+            averagingBuffer.clear();
+        }
+        return averagingBuffer.size() > 0 ? averagingBuffer.average() : lastRawWeight;
+    };
+
+private:
+    StatsRingBuffer<long, 128> averagingBuffer;
+    unsigned long deltaPerSChange;
+    long lastRawWeight;
+    uint64_t lastTimestampUs;
+};
+
+// a stable weight with noise and a spike every 100 samples
+static long rawSample(unsigned long i)
+{
+    long noise = (long)((uint32_t)(i * 2654435761u) >> 28) - 8;
+    return 250000 + noise + (i % 100 == 0 ? 20000 : 0);
+}
+
+template <typename Filter>
+static double benchmarkFilter(Filter &filter)
+{
+    return benchmarkNs(ITERATIONS, [&](unsigned long i) { benchmarkKeep(filter.process(rawSample(i), (uint64_t)i * SAMPLE_INTERVAL_US)); });
+}
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_bench_chains(void)
+{
+    LegacyAutoAveraging legacy;
+    benchmarkReport("legacy auto averaging", benchmarkFilter(legacy));
+
+    FilterChain<AdaptiveAverage<128>> adaptive;
+    adaptive.setAutoAveraging(1000, 64);
+    benchmarkReport("AdaptiveAverage<128>", benchmarkFilter(adaptive));
+
+    FilterChain<Median<5>, Ema<2>> fast;
+    benchmarkReport("Median<5>, Ema<2>", benchmarkFilter(fast));
+
+    FilterChain<Median<5>, Ema<3>, AdaptiveAverage<64>> smooth;
+    smooth.setAutoAveraging(1000, 64);
+    benchmarkReport("Median<5>, Ema<3>, AdaptiveAverage<64>", benchmarkFilter(smooth));
+}
+
+void test_adaptive_average_matches_legacy(void)
+{
+    LegacyAutoAveraging legacy;
+    FilterChain<AdaptiveAverage<128>> adaptive;
+    adaptive.setAutoAveraging(1000, 64);
+    for (unsigned long i = 1; i < 10000; i++)
+    {
+        uint64_t timestampUs = (uint64_t)i * SAMPLE_INTERVAL_US;
+        // the legacy average truncated a float, now it is rounded in integers
+        TEST_ASSERT_INT_WITHIN(1, legacy.process(rawSample(i), timestampUs), adaptive.process(rawSample(i), timestampUs));
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_chains);
+    RUN_TEST(test_adaptive_average_matches_legacy);
+    return UNITY_END();
+}
\ No newline at end of file
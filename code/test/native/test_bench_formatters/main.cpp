@@ -0,0 +1,84 @@
+#include <unity.h>
+#include <math.h>
+#include <stdio.h>
+
+#include "../bench.h"
+#include "formatters.h"
+
+#define ITERATIONS 1000000
+
+/**
+ * The printf based formatters that were used before, kept as benchmark baseline.
+ */
+static char *legacyFormatWeight(float grams)
+{
+    static char buffer[FORMAT_BUFFER_SIZE];
+    snprintf(buffer, sizeof(buffer), "%.2fg", grams);
+    return buffer;
+}
+
+static char *legacyFormatTime(unsigned long millis)
+{
+    unsigned int secs = floor(millis / 1000);
+    unsigned int mins = floor(secs / 60);
+    unsigned int _millis = millis % 1000;
+
+    static char buffer[FORMAT_BUFFER_SIZE];
+    snprintf(buffer, sizeof(buffer), "%02d:%02d.%d", mins, secs % 60, _millis / 100);
+    return buffer;
+}
+
+static int32_t weightMg(unsigned long i) { return (int32_t)((i * 2654435761u) % 200000) - 50000; }
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_bench_weight(void)
+{
+    double legacy = benchmarkNs(ITERATIONS, [](unsigned long i) { benchmarkKeep(legacyFormatWeight(weightMg(i) / 1000.0f)[0]); });
+    benchmarkReport("formatWeight sprintf", legacy);
+
+    char buffer[FORMAT_BUFFER_SIZE];
+    double fixed = benchmarkNs(ITERATIONS, [&](unsigned long i) {
+        formatWeight(buffer, weightMg(i));
+        benchmarkKeep(buffer[0]);
+    });
+    benchmarkReport("formatWeight fixed point", fixed);
+}
+
+void test_bench_time(void)
+{
+    double legacy = benchmarkNs(ITERATIONS, [](unsigned long i) { benchmarkKeep(legacyFormatTime(i * 37)[0]); });
+    benchmarkReport("formatTime sprintf", legacy);
+
+    char buffer[FORMAT_BUFFER_SIZE];
+    double fixed = benchmarkNs(ITERATIONS, [&](unsigned long i) {
+        formatTime(buffer, i * 37);
+        benchmarkKeep(buffer[0]);
+    });
+    benchmarkReport("formatTime fixed point", fixed);
+}
+
+void test_same_output_as_printf(void)
+{
+    // away from float rounding edges both agree
+    char buffer[FORMAT_BUFFER_SIZE];
+    for (unsigned long i = 0; i < 10000; i++)
+    {
+        int32_t mg = weightMg(i) / 10 * 10;
+        formatWeight(buffer, mg);
+        TEST_ASSERT_EQUAL_STRING(legacyFormatWeight(mg / 1000.0f), buffer);
+        formatTime(buffer, i * 37);
+        TEST_ASSERT_EQUAL_STRING(legacyFormatTime(i * 37), buffer);
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_weight);
+    RUN_TEST(test_bench_time);
+    RUN_TEST(test_same_output_as_printf);
+    return UNITY_END();
+}
\ No newline at end of file
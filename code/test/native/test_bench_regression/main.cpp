@@ -0,0 +1,62 @@
+#include <unity.h>
+
+#include "../bench.h"
+#include "regression.h"
+
+#define ITERATIONS 200000
+
+static Regression::Point shotPoint(unsigned long i)
+{
+    // 80 SPS, 2g/s flow
+    return {(long)(i * 12), (float)(i * 25)};
+}
+
+static void benchmarkApproximator(const char *name, uint16_t bufferSize)
+{
+    Regression::Approximator approximator(bufferSize);
+    double ns = benchmarkNs(ITERATIONS, [&](unsigned long i) {
+        approximator.addPoint(shotPoint(i));
+        long x = approximator.getXAtY(36000);
+        benchmarkKeep(x);
+    });
+    benchmarkReport(name, ns);
+}
+
+void test_bench_approximator(void)
+{
+    // cost per sample must not grow with the window size
+    benchmarkApproximator("Approximator(50) add + getXAtY", 50);
+    benchmarkApproximator("Approximator(200) add + getXAtY", 200);
+    benchmarkApproximator("Approximator(500) add + getXAtY", 500);
+}
+
+void test_bench_recursive_estimator(void)
+{
+    Regression::RecursiveEstimator estimator(0.9f);
+    double ns = benchmarkNs(ITERATIONS, [&](unsigned long i) {
+        estimator.addPoint(shotPoint(i));
+        long x = estimator.getXAtY(36000);
+        benchmarkKeep(x);
+    });
+    benchmarkReport("RecursiveEstimator(0.9) add + getXAtY", ns);
+}
+
+void test_bench_quadratic_approximator(void)
+{
+    Regression::QuadraticApproximator approximator(500);
+    double ns = benchmarkNs(ITERATIONS, [&](unsigned long i) {
+        approximator.addPoint(shotPoint(i));
+        long x = approximator.getXAtY(36000);
+        benchmarkKeep(x);
+    });
+    benchmarkReport("QuadraticApproximator(500) add + getXAtY", ns);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_approximator);
+    RUN_TEST(test_bench_recursive_estimator);
+    RUN_TEST(test_bench_quadratic_approximator);
+    return UNITY_END();
+}
@@ -0,0 +1,103 @@
+#include <unity.h>
+
+#include "../bench.h"
+#include "ring_buffer.h"
+
+#define ITERATIONS 1000000
+#define WINDOW 64
+
+/**
+ * The heap allocated ring buffer that was used before RingBuffer<T, N>, kept as benchmark baseline.
+ */
+template <typename T>
+class LegacyRingBuffer
+{
+public:
+    ~LegacyRingBuffer() { delete[] buffer; };
+    LegacyRingBuffer(uint8_t bufferSize) : bufferSize(bufferSize), head(0), full(false) { buffer = new T[bufferSize]; };
+    void push(T value)
+    {
+        buffer[head] = value;
+        if (head + 1 == bufferSize)
+        {
+            head = 0;
+            full = true;
+        }
+        else
+        {
+            head++;
+        }
+    };
+    T getRelative(int relative) const
+    {
+        int index = head + relative - 1;
+        if (index < 0)
+        {
+            index += bufferSize;
+        }
+        return buffer[index];
+    };
+    T sumLast(unsigned int count) const
+    {
+        T sum = 0;
+        for (unsigned int i = 0; i < count; i++)
+        {
+            sum += getRelative(-static_cast<int>(i));
+        }
+        return sum;
+    };
+    T averageLast(unsigned int count) const { return sumLast(count) / (float)count; };
+
+private:
+    T *buffer;
+    unsigned int bufferSize;
+    unsigned int head;
+    bool full;
+};
+
+static long sample(unsigned long i) { return 8000000 + (long)((i * 2654435761u) & 0xFF); }
+
+void test_bench_push(void)
+{
+    LegacyRingBuffer<long> legacy(WINDOW);
+    RingBuffer<long, WINDOW> ring;
+    StatsRingBuffer<long, WINDOW> stats;
+
+    benchmarkReport("push legacy", benchmarkNs(ITERATIONS, [&](unsigned long i) { legacy.push(sample(i)); }));
+    benchmarkReport("push RingBuffer<long, 64>", benchmarkNs(ITERATIONS, [&](unsigned long i) { ring.push(sample(i)); }));
+    benchmarkReport("push StatsRingBuffer<long, 64>", benchmarkNs(ITERATIONS, [&](unsigned long i) { stats.push(sample(i)); }));
+    benchmarkKeep(legacy.getRelative(0));
+    benchmarkKeep(ring.getRelative(0));
+    benchmarkKeep(stats.getRelative(0));
+}
+
+void test_bench_windowed_read(void)
+{
+    LegacyRingBuffer<long> legacy(WINDOW);
+    RingBuffer<long, WINDOW> ring;
+    StatsRingBuffer<long, WINDOW> stats;
+    for (unsigned long i = 0; i < WINDOW; i++)
+    {
+        legacy.push(sample(i));
+        ring.push(sample(i));
+        stats.push(sample(i));
+    }
+
+    long legacyAverage = 0, ringAverage = 0;
+    float statsAverage = 0;
+    benchmarkReport("averageLast(64) legacy", benchmarkNs(ITERATIONS, [&](unsigned long) { legacyAverage = legacy.averageLast(WINDOW); benchmarkKeep(legacyAverage); }));
+    benchmarkReport("averageLast(64) RingBuffer<long, 64>", benchmarkNs(ITERATIONS, [&](unsigned long) { ringAverage = ring.averageLast(WINDOW); benchmarkKeep(ringAverage); }));
+    benchmarkReport("average() StatsRingBuffer<long, 64>", benchmarkNs(ITERATIONS, [&](unsigned long) { statsAverage = stats.average(); benchmarkKeep(statsAverage); }));
+
+    // all implementations must agree on the result
+    TEST_ASSERT_EQUAL(legacyAverage, ringAverage);
+    TEST_ASSERT_EQUAL(legacyAverage, (long)statsAverage);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_push);
+    RUN_TEST(test_bench_windowed_read);
+    return UNITY_END();
+}
@@ -0,0 +1,50 @@
+#include <unity.h>
+#include <stdio.h>
+
+#include "../bench.h"
+#include "filter_chain.h"
+
+#define ITERATIONS 1000000
+
+// load cell like values, a stable weight with noise
+static long rawSample(unsigned long i)
+{
+    return 250000 + (long)((uint32_t)(i * 2654435761u) >> 22) - 512;
+}
+
+template <typename Filter>
+static double benchmarkFilter()
+{
+    Filter filter;
+    return benchmarkNs(ITERATIONS, [&](unsigned long i) { benchmarkKeep(filter.process(rawSample(i), 0)); });
+}
+
+template <uint8_t N>
+static void benchmarkWindow()
+{
+    char name[64];
+    snprintf(name, sizeof(name), "Median<%d> sorted window", N);
+    benchmarkReport(name, benchmarkFilter<Median<N>>());
+    snprintf(name, sizeof(name), "SlidingMedian<%d> two heaps", N);
+    benchmarkReport(name, benchmarkFilter<SlidingMedian<N>>());
+}
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_bench_windows(void)
+{
+    benchmarkWindow<5>();
+    benchmarkWindow<9>();
+    benchmarkWindow<15>();
+    benchmarkWindow<31>();
+    benchmarkWindow<63>();
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_windows);
+    return UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,73 @@
+#include <unity.h>
+#include <thread>
+
+#include "../bench.h"
+#include "spsc_queue.h"
+
+#define ITEMS 10000000
+
+struct Sample
+{
+    uint64_t timestamp;
+    long value;
+};
+
+void test_bench_single_thread(void)
+{
+    SpscQueue<Sample, 32> queue;
+    double ns = benchmarkNs(ITEMS, [&](unsigned long i) {
+        Sample sample;
+        queue.push({i, (long)i});
+        queue.pop(sample);
+        benchmarkKeep(sample);
+    });
+    benchmarkReport("push + pop, single thread", ns);
+}
+
+void test_bench_two_threads(void)
+{
+    static SpscQueue<Sample, 32> queue;
+
+    double ns = benchmarkNs(1, [&](unsigned long) {
+        std::thread producer([&]() {
+            for (unsigned long i = 0; i < ITEMS;)
+            {
+                if (queue.push({i, (long)i}))
+                {
+                    i++;
+                }
+                else
+                {
+                    // let the consumer run when both threads share a core
+                    std::this_thread::yield();
+                }
+            }
+        });
+
+        Sample sample;
+        for (unsigned long received = 0; received < ITEMS;)
+        {
+            if (queue.pop(sample))
+            {
+                received++;
+            }
+            else
+            {
+                std::this_thread::yield();
+            }
+        }
+        producer.join();
+        benchmarkKeep(sample);
+    });
+
+    benchmarkReport("transfer per item, producer and consumer thread", ns / ITEMS);
+    printf("BENCH throughput %.1f M items/s\n", ITEMS / ns * 1000);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_bench_single_thread);
+    RUN_TEST(test_bench_two_threads);
+    return UNITY_END();
+}
@@ -1,4 +1,5 @@
 #include <unity.h>
+#include <math.h>
 
 #include "millis.h"
 #include "button.h"
@@ -7,6 +8,18 @@
 
 DefaultWeightSensor *weightSensor;
 
+class RecordingSubscriber : public WeightSampleSubscriber
+{
+public:
+    void onSample(const WeightSample &sample) override
+    {
+        count++;
+        last = sample;
+    };
+    int count = 0;
+    WeightSample last = {};
+};
+
 void setUp(void)
 {
     weightSensor = new DefaultWeightSensor();
@@ -15,6 +28,7 @@ void setUp(void)
 void tearDown(void)
 {
     delete weightSensor;
+    LoadCell::timestampUs = 0;
 }
 
 void test_get_weight(void)
@@ -92,11 +106,170 @@ void test_weight_averaging(void)
     TEST_ASSERT_EQUAL(5250 / DIVIDER, weightSensor->getRawWeight());
 }
 
+void test_last_sample_has_capture_time(void)
+{
+    weightSensor->setScale(0.5f);
+    LoadCell::timestampUs = 1234567;
+    setWeight(200);
+
+    WeightSample sample = weightSensor->getLastSample();
+    TEST_ASSERT_EQUAL_UINT64(1234567, sample.timestampUs);
+    TEST_ASSERT_EQUAL(200, sample.raw);
+    TEST_ASSERT_EQUAL(100000, sample.weightMg);
+}
+
+void test_averaging_uses_capture_time(void)
+{
+    weightSensor->setAutoAveraging(1000, 4);
+
+    // processed back to back, but captured a second apart, so the weight
+    // changes slower than 1000 per second and averaging is enabled
+    LoadCell::timestampUs = 1000000;
+    setWeight(1000);
+    LoadCell::timestampUs = 2000000;
+    setWeight(1500);
+    LoadCell::timestampUs = 3000000;
+    setWeight(2000);
+
+    TEST_ASSERT_EQUAL(1750, weightSensor->getRawWeight());
+}
+
+void test_averaging_at_80_sps(void)
+{
+    weightSensor->setAutoAveraging(1000, 4);
+
+    // 12.5 ms between samples, a change of 5 is 400 per second
+    for (int i = 0; i < 4; i++)
+    {
+        LoadCell::timestampUs = 1000000 + i * 12500;
+        setWeight(1000 + i * 5);
+    }
+
+    // the first sample is compared against 0 and not averaged
+    TEST_ASSERT_EQUAL(1010, weightSensor->getRawWeight());
+}
+
+void test_weight_in_milligrams(void)
+{
+    weightSensor->setScale(0.5f);
+    setWeight(201);
+    TEST_ASSERT_EQUAL(100500, weightSensor->getWeightMg());
+
+    weightSensor->tare();
+    setWeight(199);
+    TEST_ASSERT_EQUAL(-1000, weightSensor->getWeightMg());
+    TEST_ASSERT_EQUAL_FLOAT(-1, weightSensor->getWeight());
+    TEST_ASSERT_EQUAL_FLOAT(99.5f, weightSensor->getLastUntaredWeight());
+}
+
+void test_fixed_point_scale(void)
+{
+    // a typical calibration, about 800 raw per gram
+    float scale = 0.00123457f;
+    FixedPointScale fixed(scale);
+    for (long raw = -8388608; raw < 8388608; raw += 9973)
+    {
+        TEST_ASSERT_INT_WITHIN(1, lround(raw * (double)scale * 1000), fixed.toMg(raw));
+    }
+    TEST_ASSERT_EQUAL(0, fixed.toMg(0));
+    TEST_ASSERT_EQUAL(-1000, FixedPointScale(-0.001f).toMg(1000));
+
+    // the largest scale a full 24 bit value converts exactly with, larger results saturate
+    TEST_ASSERT_INT_WITHIN(1000, 2147483392, FixedPointScale(0.256f).toMg(8388607));
+    TEST_ASSERT_EQUAL(INT32_MAX, FixedPointScale(1).toMg(8388607));
+    TEST_ASSERT_EQUAL(INT32_MIN, FixedPointScale(1).toMg(-8388608));
+}
+
+void test_pushes_derived_values_to_subscribers(void)
+{
+    RecordingSubscriber subscriber;
+    TEST_ASSERT_TRUE(weightSensor->subscribe(&subscriber));
+    // subscribing twice does not push twice
+    TEST_ASSERT_TRUE(weightSensor->subscribe(&subscriber));
+    weightSensor->setScale(0.001f);
+    weightSensor->setAutoAveraging(1000, 4);
+
+    LoadCell::timestampUs = 1000000;
+    setWeight(50000);
+    weightSensor->tare();
+    LoadCell::timestampUs = 1100000;
+    setWeight(50050);
+
+    TEST_ASSERT_EQUAL(2, subscriber.count);
+    TEST_ASSERT_EQUAL_UINT64(1100000, subscriber.last.timestampUs);
+    TEST_ASSERT_EQUAL(50050, subscriber.last.raw);
+    TEST_ASSERT_EQUAL(50050, subscriber.last.untaredMg);
+    TEST_ASSERT_EQUAL(50, subscriber.last.weightMg);
+    // changed by 500 per second, so averaging starts with this sample
+    TEST_ASSERT_EQUAL(50, subscriber.last.filteredMg);
+    TEST_ASSERT_EQUAL(500, subscriber.last.flowMgPerS);
+    TEST_ASSERT_TRUE(subscriber.last.stable);
+    TEST_ASSERT_EQUAL(subscriber.last.filteredMg, weightSensor->getWeightMg());
+
+    LoadCell::timestampUs = 1200000;
+    setWeight(52050);
+    TEST_ASSERT_EQUAL(20000, subscriber.last.flowMgPerS);
+    TEST_ASSERT_FALSE(subscriber.last.stable);
+
+    weightSensor->unsubscribe(&subscriber);
+    setWeight(52050);
+    TEST_ASSERT_EQUAL(3, subscriber.count);
+}
+
+void test_flow_saturates(void)
+{
+    RecordingSubscriber subscriber;
+    weightSensor->subscribe(&subscriber);
+    weightSensor->setScale(1);
+
+    LoadCell::timestampUs = 1000000;
+    setWeight(0);
+    // 5 kg within a microsecond would wrap the int32_t flow to a negative value
+    LoadCell::timestampUs = 1000001;
+    setWeight(5000);
+    TEST_ASSERT_EQUAL(INT32_MAX, subscriber.last.flowMgPerS);
+    TEST_ASSERT_FALSE(subscriber.last.stable);
+
+    LoadCell::timestampUs = 1000002;
+    setWeight(0);
+    TEST_ASSERT_EQUAL(INT32_MIN, subscriber.last.flowMgPerS);
+    TEST_ASSERT_FALSE(subscriber.last.stable);
+    weightSensor->unsubscribe(&subscriber);
+}
+
+void test_subscriber_table_is_fixed(void)
+{
+    RecordingSubscriber subscribers[WEIGHT_MAX_SUBSCRIBERS + 1];
+    for (int i = 0; i < WEIGHT_MAX_SUBSCRIBERS; i++)
+    {
+        TEST_ASSERT_TRUE(weightSensor->subscribe(&subscribers[i]));
+    }
+    TEST_ASSERT_FALSE(weightSensor->subscribe(&subscribers[WEIGHT_MAX_SUBSCRIBERS]));
+
+    // a removed subscriber frees its slot, the others keep getting samples
+    weightSensor->unsubscribe(&subscribers[0]);
+    TEST_ASSERT_TRUE(weightSensor->subscribe(&subscribers[WEIGHT_MAX_SUBSCRIBERS]));
+    setWeight(10);
+    TEST_ASSERT_EQUAL(0, subscribers[0].count);
+    for (int i = 1; i <= WEIGHT_MAX_SUBSCRIBERS; i++)
+    {
+        TEST_ASSERT_EQUAL(1, subscribers[i].count);
+    }
+}
+
 int main(void)
 {
     UNITY_BEGIN();
     RUN_TEST(test_get_weight);
     RUN_TEST(test_new_weight);
     RUN_TEST(test_weight_averaging);
+    RUN_TEST(test_last_sample_has_capture_time);
+    RUN_TEST(test_averaging_uses_capture_time);
+    RUN_TEST(test_averaging_at_80_sps);
+    RUN_TEST(test_weight_in_milligrams);
+    RUN_TEST(test_fixed_point_scale);
+    RUN_TEST(test_pushes_derived_values_to_subscribers);
+    RUN_TEST(test_subscriber_table_is_fixed);
+    RUN_TEST(test_flow_saturates);
     UNITY_END();
 }
\ No newline at end of file
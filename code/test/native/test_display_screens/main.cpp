@@ -0,0 +1,248 @@
+#include <unity.h>
+#include <cstring>
+#include <string>
+
+#include "display_renderer.h"
+#include "millis.h"
+
+// relative to the project directory, where pio runs the tests
+#define GOLDEN_DIR "test/native/test_display_screens/golden"
+
+U8g2Framebuffer *framebuffer;
+DisplayRenderer *renderer;
+
+void setUp(void)
+{
+    VirtualClock::reset();
+    // blinking values are visible in the second half of each second
+    VirtualClock::advance(500);
+    framebuffer = new U8g2Framebuffer();
+    renderer = new DisplayRenderer(*framebuffer);
+}
+
+void tearDown(void)
+{
+    delete renderer;
+    delete framebuffer;
+}
+
+static std::string readAll(FILE *file)
+{
+    std::string content;
+    char buffer[256];
+    size_t read;
+    while ((read = fread(buffer, 1, sizeof(buffer), file)) > 0)
+    {
+        content.append(buffer, read);
+    }
+    return content;
+}
+
+static int countPixels()
+{
+    int count = 0;
+    for (int y = 0; y < framebuffer->getDisplayHeight(); y++)
+    {
+        for (int x = 0; x < framebuffer->getDisplayWidth(); x++)
+        {
+            count += framebuffer->getPixel(x, y);
+        }
+    }
+    return count;
+}
+
+/**
+ * Compares the framebuffer to the golden image, with UPDATE_GOLDEN set the image is written instead.
+ *
+ * Without the image the comparison is reported as ignored, so a checkout without images neither passes
+ * nor fails on it. The checks of a test before the comparison still run.
+ */
+static void assertGolden(const char *name)
+{
+    char path[128];
+    snprintf(path, sizeof(path), GOLDEN_DIR "/%s.pbm", name);
+
+    FILE *actualFile = tmpfile();
+    framebuffer->writePbm(actualFile);
+    rewind(actualFile);
+    std::string actual = readAll(actualFile);
+    fclose(actualFile);
+
+    if (getenv("UPDATE_GOLDEN") != nullptr)
+    {
+        FILE *golden = fopen(path, "w");
+        TEST_ASSERT_NOT_NULL(golden);
+        fwrite(actual.data(), 1, actual.size(), golden);
+        fclose(golden);
+        printf("  wrote %s\n", path);
+        return;
+    }
+
+    FILE *golden = fopen(path, "r");
+    if (golden == nullptr)
+    {
+        char message[192];
+        snprintf(message, sizeof(message), "no golden image %s, run with UPDATE_GOLDEN=1 to create it", path);
+        TEST_IGNORE_MESSAGE(message);
+    }
+
+    std::string expected = readAll(golden);
+    fclose(golden);
+    TEST_ASSERT_EQUAL_STRING(expected.c_str(), actual.c_str());
+}
+
+void test_buffer_matches_device(void)
+{
+    TEST_ASSERT_EQUAL(128, framebuffer->getDisplayWidth());
+    TEST_ASSERT_EQUAL(64, framebuffer->getDisplayHeight());
+    TEST_ASSERT_EQUAL(8, framebuffer->getBufferTileWidth());
+    TEST_ASSERT_EQUAL(16, framebuffer->getBufferTileHeight());
+}
+
+void test_pixel_orientation(void)
+{
+    framebuffer->clearBuffer();
+    framebuffer->drawBox(0, 0, 10, 2);
+    TEST_ASSERT_EQUAL(20, countPixels());
+    TEST_ASSERT_TRUE(framebuffer->getPixel(0, 0));
+    TEST_ASSERT_TRUE(framebuffer->getPixel(9, 1));
+    TEST_ASSERT_FALSE(framebuffer->getPixel(10, 0));
+    TEST_ASSERT_FALSE(framebuffer->getPixel(0, 2));
+}
+
+void test_unchanged_screen_is_skipped(void)
+{
+    TEST_ASSERT_TRUE(renderer->weight(12300, 4000));
+    TEST_ASSERT_FALSE(renderer->weight(12300, 4000));
+    TEST_ASSERT_TRUE(renderer->weight(12400, 4000));
+
+    // a clear always lets the next screen through
+    renderer->clear();
+    TEST_ASSERT_EQUAL(0, countPixels());
+    TEST_ASSERT_TRUE(renderer->weight(12400, 4000));
+}
+
+void test_opener(void)
+{
+    TEST_ASSERT_TRUE(renderer->opener("1.2.3"));
+    TEST_ASSERT_GREATER_THAN(0, countPixels());
+    assertGolden("opener");
+}
+
+void test_weight(void)
+{
+    TEST_ASSERT_TRUE(renderer->weight(12300, 65000));
+    TEST_ASSERT_GREATER_THAN(0, countPixels());
+    assertGolden("weight");
+}
+
+void test_prompt_text(void)
+{
+    TEST_ASSERT_TRUE(renderer->promptText("Prompt", "Some text"));
+    assertGolden("prompt_text");
+}
+
+void test_center_text(void)
+{
+    TEST_ASSERT_TRUE(renderer->centerText("Done!", 16));
+    assertGolden("center_text");
+}
+
+void test_switcher(void)
+{
+    const char *options[] = {"Scale", "Recipes", "Espresso", "Calibrate", "Settings", "Update"};
+    TEST_ASSERT_TRUE(renderer->switcher("Title", 4, 6, options));
+    assertGolden("switcher");
+}
+
+void test_recipe_summary(void)
+{
+    TEST_ASSERT_TRUE(renderer->recipeSummary("Aeropress", "A recipe with a long description that wraps over several lines.", nullptr));
+    assertGolden("recipe_summary");
+}
+
+void test_recipe_summary_qr_code(void)
+{
+    TEST_ASSERT_TRUE(renderer->recipeSummary("Aeropress", "Scan for the video.", "youtu.be/j6VlT_jUVPc"));
+    assertGolden("recipe_summary_qr_code");
+}
+
+void test_qr_code_cache_follows_url(void)
+{
+    static uint8_t first[1024];
+    renderer->recipeSummary("Aeropress", "Scan for the video.", "youtu.be/j6VlT_jUVPc");
+    memcpy(first, framebuffer->getBufferPtr(), sizeof(first));
+
+    // a different url is encoded again
+    renderer->recipeSummary("Aeropress", "Scan for the video.", "youtu.be/st571DYYTR8");
+    TEST_ASSERT_TRUE(memcmp(first, framebuffer->getBufferPtr(), sizeof(first)) != 0);
+
+    renderer->recipeSummary("Aeropress", "Scan for the video.", "youtu.be/j6VlT_jUVPc");
+    TEST_ASSERT_EQUAL_MEMORY(first, framebuffer->getBufferPtr(), sizeof(first));
+}
+
+void test_recipe_config_weight(void)
+{
+    TEST_ASSERT_TRUE(renderer->recipeConfigCoffeeWeight("Aeropress", 12000, 200));
+    assertGolden("recipe_config_weight");
+}
+
+void test_recipe_config_ratio(void)
+{
+    TEST_ASSERT_TRUE(renderer->recipeConfigRatio("Aeropress", 10, 167));
+    assertGolden("recipe_config_ratio");
+}
+
+void test_recipe_insert_coffee(void)
+{
+    TEST_ASSERT_TRUE(renderer->recipeInsertCoffee(11500, 12000));
+    assertGolden("recipe_insert_coffee");
+}
+
+void test_recipe_pour(void)
+{
+    TEST_ASSERT_TRUE(renderer->recipePour("Pour water in a spiral, then stir three times.", -120000, 75000, false, 1, 3));
+    assertGolden("recipe_pour");
+}
+
+void test_text(void)
+{
+    TEST_ASSERT_TRUE(renderer->text("Add weight to scale.\n\nClick to continue!"));
+    assertGolden("text");
+}
+
+void test_mode_switcher(void)
+{
+    TEST_ASSERT_TRUE(renderer->modeSwitcher("Recipes", 1, 5, 3.92, 80, false));
+    assertGolden("mode_switcher");
+}
+
+void test_espresso_shot(void)
+{
+    TEST_ASSERT_TRUE(renderer->espressoShot(21300, 6200, 28400, 36000, false));
+    assertGolden("espresso_shot");
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_buffer_matches_device);
+    RUN_TEST(test_pixel_orientation);
+    RUN_TEST(test_unchanged_screen_is_skipped);
+    RUN_TEST(test_opener);
+    RUN_TEST(test_weight);
+    RUN_TEST(test_prompt_text);
+    RUN_TEST(test_center_text);
+    RUN_TEST(test_switcher);
+    RUN_TEST(test_recipe_summary);
+    RUN_TEST(test_recipe_summary_qr_code);
+    RUN_TEST(test_qr_code_cache_follows_url);
+    RUN_TEST(test_recipe_config_weight);
+    RUN_TEST(test_recipe_config_ratio);
+    RUN_TEST(test_recipe_insert_coffee);
+    RUN_TEST(test_recipe_pour);
+    RUN_TEST(test_text);
+    RUN_TEST(test_mode_switcher);
+    RUN_TEST(test_espresso_shot);
+    return UNITY_END();
+}
\ No newline at end of file
@@ -1,20 +1,13 @@
 #include "ring_buffer.h"
 #include <unity.h>
 
-/*
-0 1 2
-
-1 2 3
-4
-*/
-
 void setUp(void) {}
 
 void tearDown(void) {}
 
 void test_ring_buffer_push(void)
 {
-    RingBuffer<int> ringBuffer(3);
+    RingBuffer<int, 4> ringBuffer(3);
     TEST_ASSERT_EQUAL(3, ringBuffer.capacity());
     TEST_ASSERT_EQUAL(0, ringBuffer.size());
 
@@ -30,28 +23,47 @@ void test_ring_buffer_push(void)
 
 void test_ring_buffer_get(void)
 {
-    RingBuffer<int> ringBuffer(3);
+    RingBuffer<int, 4> ringBuffer(3);
     // push 4 elements, last 3 should remain
     ringBuffer.push(1);
     ringBuffer.push(2);
     ringBuffer.push(3);
     ringBuffer.push(4);
 
-    /*
-    0 1 2
+    // get indexes from the oldest value
+    TEST_ASSERT_EQUAL(2, ringBuffer.get(0));
+    TEST_ASSERT_EQUAL(3, ringBuffer.get(1));
+    TEST_ASSERT_EQUAL(4, ringBuffer.get(2));
+}
 
-    1 2 3
-    4
-    */
+void test_ring_buffer_full_storage(void)
+{
+    RingBuffer<int, 4> ringBuffer;
+    TEST_ASSERT_EQUAL(4, ringBuffer.capacity());
+    TEST_ASSERT_EQUAL(4, ringBuffer.maxCapacity());
+
+    for (int i = 1; i <= 6; i++)
+    {
+        ringBuffer.push(i);
+    }
+
+    TEST_ASSERT_EQUAL(4, ringBuffer.size());
+    TEST_ASSERT_EQUAL(6, ringBuffer.getRelative(0));
+    TEST_ASSERT_EQUAL(3, ringBuffer.getRelative(-3));
+    TEST_ASSERT_EQUAL(3, ringBuffer.get(0));
+    TEST_ASSERT_EQUAL(18, ringBuffer.sumLast(4));
+}
 
-    TEST_ASSERT_EQUAL(4, ringBuffer.get(0));
-    TEST_ASSERT_EQUAL(2, ringBuffer.get(1));
-    TEST_ASSERT_EQUAL(3, ringBuffer.get(2));
+void test_ring_buffer_size_is_capped(void)
+{
+    // a size larger than the storage is capped, no values are written out of bounds
+    RingBuffer<int, 4> ringBuffer(300);
+    TEST_ASSERT_EQUAL(4, ringBuffer.capacity());
 }
 
 void test_ring_buffer_get_relative(void)
 {
-    RingBuffer<int> ringBuffer(3);
+    RingBuffer<int, 4> ringBuffer(3);
     ringBuffer.push(1);
     ringBuffer.push(2);
     ringBuffer.push(3);
@@ -63,7 +75,7 @@ void test_ring_buffer_get_relative(void)
 
 void test_ring_buffer_sum_last(void)
 {
-    RingBuffer<int> ringBuffer(3);
+    RingBuffer<int, 4> ringBuffer(3);
     ringBuffer.push(1);
     ringBuffer.push(2);
     ringBuffer.push(3);
@@ -75,7 +87,7 @@ void test_ring_buffer_sum_last(void)
 
 void test_ring_buffer_variance_and_stddev(void)
 {
-    RingBuffer<float> ringBuffer(5);
+    RingBuffer<float, 8> ringBuffer(5);
     ringBuffer.push(1.0);
     ringBuffer.push(2.0);
     ringBuffer.push(3.0);
@@ -93,13 +105,90 @@ void test_ring_buffer_variance_and_stddev(void)
     TEST_ASSERT_FLOAT_WITHIN(0.01, expectedStddev, stddev); // allow small margin of error
 }
 
+void test_stats_ring_buffer_matches_full_scan(void)
+{
+    RingBuffer<float, 8> ringBuffer(7);
+    StatsRingBuffer<float, 8> statsBuffer(7);
+
+    // push enough values to wrap around multiple times
+    for (int i = 0; i < 50; i++)
+    {
+        float value = 100.0f + (i * 37 % 11) * 0.25f;
+        ringBuffer.push(value);
+        statsBuffer.push(value);
+
+        unsigned int count = ringBuffer.size();
+        TEST_ASSERT_EQUAL(count, statsBuffer.size());
+        TEST_ASSERT_FLOAT_WITHIN(0.0001, ringBuffer.averageLast(count), statsBuffer.average());
+        TEST_ASSERT_FLOAT_WITHIN(0.0001, ringBuffer.varianceLast(count), statsBuffer.variance());
+        TEST_ASSERT_FLOAT_WITHIN(0.0001, ringBuffer.standardDeviationLast(count), statsBuffer.standardDeviation());
+    }
+}
+
+void test_stats_ring_buffer_integral(void)
+{
+    StatsRingBuffer<long, 4> statsBuffer;
+    // values in the range of raw loadcell readings
+    statsBuffer.push(8000000);
+    statsBuffer.push(8000002);
+    statsBuffer.push(8000004);
+    statsBuffer.push(8000006);
+    TEST_ASSERT_TRUE(statsBuffer.isFull());
+    TEST_ASSERT_EQUAL_FLOAT(8000003, statsBuffer.average());
+    TEST_ASSERT_EQUAL_FLOAT(5, statsBuffer.variance());
+
+    // evicts the first value
+    statsBuffer.push(8000008);
+    TEST_ASSERT_EQUAL_FLOAT(8000005, statsBuffer.average());
+    TEST_ASSERT_EQUAL_FLOAT(5, statsBuffer.variance());
+}
+
+void test_stats_ring_buffer_clear(void)
+{
+    StatsRingBuffer<long, 4> statsBuffer(3);
+    statsBuffer.push(10);
+    statsBuffer.push(20);
+    statsBuffer.clear();
+    TEST_ASSERT_EQUAL(0, statsBuffer.size());
+
+    statsBuffer.push(-5);
+    TEST_ASSERT_EQUAL_FLOAT(-5, statsBuffer.average());
+    TEST_ASSERT_EQUAL_FLOAT(0, statsBuffer.variance());
+}
+
+void test_stats_ring_buffer_rounded_average(void)
+{
+    StatsRingBuffer<long, 4> statsBuffer;
+    statsBuffer.push(8000000);
+    statsBuffer.push(8000001);
+    TEST_ASSERT_EQUAL(8000001, statsBuffer.roundedAverage());
+    statsBuffer.push(7999995);
+    TEST_ASSERT_EQUAL(7999999, statsBuffer.roundedAverage());
+
+    // halves round away from zero, relative to the first value as well
+    statsBuffer.clear();
+    statsBuffer.push(-4);
+    statsBuffer.push(-7);
+    TEST_ASSERT_EQUAL(-6, statsBuffer.roundedAverage());
+    statsBuffer.clear();
+    statsBuffer.push(10);
+    statsBuffer.push(7);
+    TEST_ASSERT_EQUAL(9, statsBuffer.roundedAverage());
+}
+
 int main(void)
 {
     UNITY_BEGIN();
     RUN_TEST(test_ring_buffer_push);
     RUN_TEST(test_ring_buffer_get);
     RUN_TEST(test_ring_buffer_get_relative);
+    RUN_TEST(test_ring_buffer_full_storage);
+    RUN_TEST(test_ring_buffer_size_is_capped);
     RUN_TEST(test_ring_buffer_sum_last);
     RUN_TEST(test_ring_buffer_variance_and_stddev);
+    RUN_TEST(test_stats_ring_buffer_matches_full_scan);
+    RUN_TEST(test_stats_ring_buffer_integral);
+    RUN_TEST(test_stats_ring_buffer_clear);
+    RUN_TEST(test_stats_ring_buffer_rounded_average);
     UNITY_END();
 }
\ No newline at end of file
@@ -0,0 +1,113 @@
+#include <unity.h>
+
+#include "filter_chain.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_median_removes_spikes(void)
+{
+    Median<5> median;
+    TEST_ASSERT_EQUAL(10, median.process(10, 0));
+    TEST_ASSERT_EQUAL(10, median.process(1000, 0));
+    TEST_ASSERT_EQUAL(11, median.process(11, 0));
+    TEST_ASSERT_EQUAL(11, median.process(12, 0));
+    TEST_ASSERT_EQUAL(11, median.process(-500, 0));
+    // the window is full, the first 10 leaves it
+    TEST_ASSERT_EQUAL(12, median.process(13, 0));
+    // and the spike
+    TEST_ASSERT_EQUAL(12, median.process(14, 0));
+    TEST_ASSERT_EQUAL(13, median.process(15, 0));
+
+    median.reset();
+    TEST_ASSERT_EQUAL(-3, median.process(-3, 0));
+}
+
+void test_median_keeps_duplicates(void)
+{
+    Median<3> median;
+    median.process(5, 0);
+    median.process(5, 0);
+    median.process(1, 0);
+    // evicts one of the 5s
+    TEST_ASSERT_EQUAL(5, median.process(9, 0));
+    TEST_ASSERT_EQUAL(1, median.process(0, 0));
+}
+
+void test_ema_starts_at_first_sample_and_converges(void)
+{
+    Ema<2> ema;
+    TEST_ASSERT_EQUAL(1000, ema.process(1000, 0));
+    // moves a quarter of the way per sample
+    TEST_ASSERT_EQUAL(1100, ema.process(1400, 0));
+    TEST_ASSERT_EQUAL(1175, ema.process(1400, 0));
+    for (int i = 0; i < 50; i++)
+    {
+        ema.process(1400, 0);
+    }
+    TEST_ASSERT_EQUAL(1400, ema.process(1400, 0));
+
+    ema.reset();
+    TEST_ASSERT_EQUAL(-200, ema.process(-200, 0));
+    TEST_ASSERT_EQUAL(-250, ema.process(-400, 0));
+}
+
+void test_adaptive_average_only_while_stable(void)
+{
+    AdaptiveAverage<4> average;
+    // disabled by default
+    TEST_ASSERT_EQUAL(100, average.process(100, 1000000));
+    TEST_ASSERT_EQUAL(101, average.process(101, 2000000));
+
+    average.setAutoAveraging(10, 4);
+    TEST_ASSERT_EQUAL(102, average.process(102, 3000000));
+    TEST_ASSERT_EQUAL(103, average.process(104, 4000000));
+    TEST_ASSERT_EQUAL(104, average.process(106, 5000000));
+    // 2 per second is still slower than 10
+    TEST_ASSERT_EQUAL(105, average.process(108, 6000000));
+    TEST_ASSERT_EQUAL(107, average.process(110, 7000000));
+    // 20 per second resets the average
+    TEST_ASSERT_EQUAL(130, average.process(130, 8000000));
+    TEST_ASSERT_EQUAL(131, average.process(131, 9000000));
+}
+
+void test_chain_feeds_stages_in_order(void)
+{
+    FilterChain<Median<3>, Ema<1>> chain;
+    TEST_ASSERT_EQUAL(100, chain.process(100, 0));
+    // the spike is removed before it reaches the average
+    TEST_ASSERT_EQUAL(100, chain.process(5000, 0));
+    TEST_ASSERT_EQUAL(150, chain.process(200, 0));
+
+    chain.reset();
+    TEST_ASSERT_EQUAL(7, chain.process(7, 0));
+}
+
+void test_chain_configures_and_exposes_stages(void)
+{
+    FilterChain<Median<3>, AdaptiveAverage<8>> chain;
+    TEST_ASSERT_TRUE(&chain.stage<AdaptiveAverage<8>>() == &chain.tail().head());
+
+    chain.setAutoAveraging(1000, 2);
+    chain.process(10, 1000000);
+    chain.process(12, 2000000);
+    // median of 10 and 12 is 10, then averaged with the median 12 of the full window
+    TEST_ASSERT_EQUAL(11, chain.process(12, 3000000));
+    TEST_ASSERT_EQUAL(12, chain.stage<Median<3>>().process(12, 0));
+
+    FilterChain<> empty;
+    TEST_ASSERT_EQUAL(-42, empty.process(-42, 0));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_median_removes_spikes);
+    RUN_TEST(test_median_keeps_duplicates);
+    RUN_TEST(test_ema_starts_at_first_sample_and_converges);
+    RUN_TEST(test_adaptive_average_only_while_stable);
+    RUN_TEST(test_chain_feeds_stages_in_order);
+    RUN_TEST(test_chain_configures_and_exposes_stages);
+    return UNITY_END();
+}
\ No newline at end of file
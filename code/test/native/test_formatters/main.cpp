@@ -0,0 +1,102 @@
+#include <unity.h>
+
+#include "formatters.h"
+
+char buffer[FORMAT_BUFFER_SIZE];
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_unsigned(void)
+{
+    char *end = formatUnsigned(buffer, 0);
+    TEST_ASSERT_EQUAL_STRING("0", buffer);
+    TEST_ASSERT_EQUAL(buffer + 1, end);
+
+    formatUnsigned(buffer, 7, 2);
+    TEST_ASSERT_EQUAL_STRING("07", buffer);
+    formatUnsigned(buffer, 123, 2);
+    TEST_ASSERT_EQUAL_STRING("123", buffer);
+    formatUnsigned(buffer, 4294967295u);
+    TEST_ASSERT_EQUAL_STRING("4294967295", buffer);
+}
+
+void test_fixed_rounds_half_away_from_zero(void)
+{
+    formatFixed(buffer, 12345, 3, 2);
+    TEST_ASSERT_EQUAL_STRING("12.35", buffer);
+    formatFixed(buffer, 12344, 3, 2);
+    TEST_ASSERT_EQUAL_STRING("12.34", buffer);
+    formatFixed(buffer, -12345, 3, 2);
+    TEST_ASSERT_EQUAL_STRING("-12.35", buffer);
+    formatFixed(buffer, 19999, 3, 1);
+    TEST_ASSERT_EQUAL_STRING("20.0", buffer);
+}
+
+void test_fixed_small_values(void)
+{
+    formatFixed(buffer, 50, 3, 2);
+    TEST_ASSERT_EQUAL_STRING("0.05", buffer);
+    formatFixed(buffer, 0, 3, 1);
+    TEST_ASSERT_EQUAL_STRING("0.0", buffer);
+    // no negative zero
+    formatFixed(buffer, -4, 3, 2);
+    TEST_ASSERT_EQUAL_STRING("0.00", buffer);
+    formatFixed(buffer, -5, 3, 2);
+    TEST_ASSERT_EQUAL_STRING("-0.01", buffer);
+}
+
+void test_fixed_decimals(void)
+{
+    formatFixed(buffer, 167, 1, 1);
+    TEST_ASSERT_EQUAL_STRING("16.7", buffer);
+    formatFixed(buffer, 3, 0, 2);
+    TEST_ASSERT_EQUAL_STRING("3.00", buffer);
+    formatFixed(buffer, 1500, 3, 0);
+    TEST_ASSERT_EQUAL_STRING("2", buffer);
+}
+
+void test_append(void)
+{
+    char *end = appendText(formatFixed(buffer, 36000, 3, 1), "g/");
+    appendText(formatFixed(end, 28400, 3, 1), "g");
+    TEST_ASSERT_EQUAL_STRING("36.0g/28.4g", buffer);
+}
+
+void test_weight(void)
+{
+    formatWeight(buffer, 12345);
+    TEST_ASSERT_EQUAL_STRING("12.35g", buffer);
+    formatWeight(buffer, -120000);
+    TEST_ASSERT_EQUAL_STRING("-120.00g", buffer);
+    char *end = formatWeight(buffer, -2147483647 - 1);
+    TEST_ASSERT_EQUAL_STRING("-2147483.65g", buffer);
+    TEST_ASSERT_LESS_THAN(FORMAT_BUFFER_SIZE, end - buffer);
+}
+
+void test_time(void)
+{
+    formatTime(buffer, 0);
+    TEST_ASSERT_EQUAL_STRING("00:00.0", buffer);
+    // tenths are cut
+    formatTime(buffer, 65399);
+    TEST_ASSERT_EQUAL_STRING("01:05.3", buffer);
+    formatTime(buffer, 100 * 60000);
+    TEST_ASSERT_EQUAL_STRING("100:00.0", buffer);
+    formatTime(buffer, 4294967295u);
+    TEST_ASSERT_EQUAL_STRING("71582:47.2", buffer);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_unsigned);
+    RUN_TEST(test_fixed_rounds_half_away_from_zero);
+    RUN_TEST(test_fixed_small_values);
+    RUN_TEST(test_fixed_decimals);
+    RUN_TEST(test_append);
+    RUN_TEST(test_weight);
+    RUN_TEST(test_time);
+    return UNITY_END();
+}
\ No newline at end of file
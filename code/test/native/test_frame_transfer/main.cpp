@@ -0,0 +1,118 @@
+#include <unity.h>
+#include <vector>
+
+#include "frame_transfer.h"
+
+#define ROW_BYTES (8 * TILE_BYTES)
+
+static std::vector<uint8_t> sentRows;
+static std::vector<uint8_t> sentBytes;
+static uint8_t buffer[8 * 16 * TILE_BYTES];
+
+static void send(uint8_t tx, uint8_t ty, uint8_t tw, const uint8_t *tiles)
+{
+    sentRows.push_back(ty);
+    sentBytes.insert(sentBytes.end(), tiles, tiles + tw * TILE_BYTES);
+}
+
+static void setPixel(uint8_t x, uint8_t y) { buffer[(y / 8) * ROW_BYTES + x] |= 1 << (y % 8); }
+
+void setUp(void)
+{
+    sentRows.clear();
+    sentBytes.clear();
+    memset(buffer, 0, sizeof(buffer));
+}
+
+void tearDown(void) {}
+
+void test_frame_is_sent_in_chunks(void)
+{
+    FrameTransfer<8, 16> transfer;
+    TEST_ASSERT_FALSE(transfer.isBusy());
+
+    transfer.submit(buffer);
+    TEST_ASSERT_TRUE(transfer.isBusy());
+
+    // two rows per step
+    int steps = 1;
+    while (!transfer.step(send, 2 * ROW_BYTES))
+    {
+        TEST_ASSERT_EQUAL(2 * steps, sentRows.size());
+        steps++;
+    }
+    TEST_ASSERT_EQUAL(8, steps);
+    TEST_ASSERT_FALSE(transfer.isBusy());
+    TEST_ASSERT_EQUAL(1024, transfer.getLastFrameBytes());
+}
+
+void test_composing_does_not_change_pending_frame(void)
+{
+    FrameTransfer<8, 16> transfer;
+    transfer.submit(buffer);
+    transfer.flush(send);
+    sentRows.clear();
+    sentBytes.clear();
+
+    setPixel(0, 0);
+    transfer.submit(buffer);
+    // the next frame is drawn into the buffer while the last one is sent
+    memset(buffer, 0, sizeof(buffer));
+    setPixel(0, 120);
+    transfer.flush(send);
+
+    TEST_ASSERT_EQUAL(1, sentRows.size());
+    TEST_ASSERT_EQUAL(0, sentRows[0]);
+    // the submitted frame is sent, not the one drawn afterwards
+    TEST_ASSERT_EQUAL(TILE_BYTES, sentBytes.size());
+    TEST_ASSERT_EQUAL(1, sentBytes[0]);
+}
+
+void test_unchanged_rows_do_not_use_the_budget(void)
+{
+    FrameTransfer<8, 16> transfer;
+    transfer.submit(buffer);
+    transfer.flush(send);
+    sentRows.clear();
+
+    setPixel(0, 120);
+    transfer.submit(buffer);
+    // all unchanged rows are compared in the same step as the changed one
+    TEST_ASSERT_TRUE(transfer.step(send, ROW_BYTES));
+    TEST_ASSERT_EQUAL(1, sentRows.size());
+    TEST_ASSERT_EQUAL(8, transfer.getLastFrameBytes());
+}
+
+void test_rows_are_not_starved_by_new_frames(void)
+{
+    FrameTransfer<8, 16> transfer;
+    transfer.submit(buffer);
+    transfer.flush(send);
+    sentRows.clear();
+
+    // the bottom row changes once, the top row with every frame
+    setPixel(0, 127);
+    for (uint8_t i = 0; i < 32; i++)
+    {
+        buffer[0] = i + 1;
+        transfer.submit(buffer);
+        transfer.step(send, ROW_BYTES);
+    }
+
+    bool bottomSent = false;
+    for (uint8_t row : sentRows)
+    {
+        bottomSent |= row == 15;
+    }
+    TEST_ASSERT_TRUE(bottomSent);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_frame_is_sent_in_chunks);
+    RUN_TEST(test_composing_does_not_change_pending_frame);
+    RUN_TEST(test_unchanged_rows_do_not_use_the_budget);
+    RUN_TEST(test_rows_are_not_starved_by_new_frames);
+    UNITY_END();
+}
\ No newline at end of file
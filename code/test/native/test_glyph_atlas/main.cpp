@@ -0,0 +1,171 @@
+#include <unity.h>
+#include <string.h>
+
+#include "glyph_atlas.h"
+#include "fonts/roboto_mono_20_atlas.h"
+#include "fonts/roboto_mono_22_atlas.h"
+#include "fonts/roboto_mono_26_atlas.h"
+
+#define WIDTH 128
+#define HEIGHT 64
+
+// a guard byte on each side catches writes outside the screen
+static uint8_t memory[WIDTH * HEIGHT / 8 + 2];
+static uint8_t *buffer = memory + 1;
+
+// 'L': 3 x 3, drawn one pixel right of the pen, bottom row on the baseline
+static const uint8_t tinyBits[] = {
+    0x01,
+    0x01,
+    0x07,
+    // '=': 10 x 2, two bytes per row
+    0xff, 0x03,
+    0x00, 0x00,
+};
+static const AtlasGlyph tinyGlyphs[] = {
+    {'=', 12, 10, 2, 0, -2, 3},
+    {'L', 5, 3, 3, 1, -3, 0},
+};
+static const GlyphAtlas tiny = {tinyGlyphs, 2, tinyBits, 3, 0};
+
+static bool pixel(int x, int y)
+{
+    // same mapping as the SH1107 with U8G2_R1
+    return buffer[(x / 8) * HEIGHT + HEIGHT - 1 - y] & (1 << (x % 8));
+}
+
+static int countPixels()
+{
+    int count = 0;
+    for (int x = 0; x < WIDTH; x++)
+    {
+        for (int y = 0; y < HEIGHT; y++)
+        {
+            count += pixel(x, y);
+        }
+    }
+    return count;
+}
+
+void setUp(void)
+{
+    memset(memory, 0, sizeof(memory));
+}
+
+void tearDown(void)
+{
+    TEST_ASSERT_EQUAL_UINT8(0, memory[0]);
+    TEST_ASSERT_EQUAL_UINT8(0, memory[sizeof(memory) - 1]);
+}
+
+void test_draws_aligned_glyph(void)
+{
+    int end = drawAtlasText(buffer, WIDTH, HEIGHT, tiny, 7, 10, "L");
+
+    TEST_ASSERT_EQUAL(12, end);
+    TEST_ASSERT_TRUE(pixel(8, 7));
+    TEST_ASSERT_TRUE(pixel(8, 8));
+    TEST_ASSERT_TRUE(pixel(8, 9));
+    TEST_ASSERT_TRUE(pixel(9, 9));
+    TEST_ASSERT_TRUE(pixel(10, 9));
+    TEST_ASSERT_EQUAL(5, countPixels());
+}
+
+void test_draws_unaligned_glyph_across_columns(void)
+{
+    drawAtlasText(buffer, WIDTH, HEIGHT, tiny, 5, 2, "=");
+
+    for (int x = 5; x < 15; x++)
+    {
+        TEST_ASSERT_TRUE(pixel(x, 0));
+    }
+    TEST_ASSERT_EQUAL(10, countPixels());
+}
+
+void test_advances_and_skips_missing_characters(void)
+{
+    int end = drawAtlasText(buffer, WIDTH, HEIGHT, tiny, 0, 10, "L?L");
+
+    TEST_ASSERT_EQUAL(10, end);
+    TEST_ASSERT_TRUE(pixel(6, 9));
+    TEST_ASSERT_EQUAL(10, countPixels());
+    TEST_ASSERT_EQUAL(29, atlasTextWidth(tiny, "=x=L"));
+    TEST_ASSERT_NULL(findAtlasGlyph(tiny, 'x'));
+}
+
+void test_clips_at_screen_edges(void)
+{
+    drawAtlasText(buffer, WIDTH, HEIGHT, tiny, -3, 2, "=");
+    TEST_ASSERT_EQUAL(7, countPixels());
+    TEST_ASSERT_TRUE(pixel(0, 0));
+    TEST_ASSERT_TRUE(pixel(6, 0));
+
+    memset(memory, 0, sizeof(memory));
+    drawAtlasText(buffer, WIDTH, HEIGHT, tiny, WIDTH - 4, HEIGHT + 1, "=L");
+    TEST_ASSERT_EQUAL(4, countPixels());
+    TEST_ASSERT_TRUE(pixel(WIDTH - 1, HEIGHT - 1));
+
+    memset(memory, 0, sizeof(memory));
+    drawAtlasText(buffer, WIDTH, HEIGHT, tiny, 0, 1, "L");
+    TEST_ASSERT_EQUAL(3, countPixels());
+    TEST_ASSERT_TRUE(pixel(1, 0));
+}
+
+void test_generated_atlas_fits_weight_screen(void)
+{
+    const GlyphAtlas &atlas = roboto_mono_20_atlas;
+
+    for (uint8_t i = 0; i < atlas.count; i++)
+    {
+        const AtlasGlyph &glyph = atlas.glyphs[i];
+        TEST_ASSERT_LESS_OR_EQUAL((int)sizeof(roboto_mono_20_atlas_bits), glyph.offset + glyph.height * ((glyph.width + 7) / 8));
+        TEST_ASSERT_LESS_OR_EQUAL(glyph.advance, glyph.xOffset + glyph.width);
+    }
+    TEST_ASSERT_NOT_NULL(findAtlasGlyph(atlas, 'g'));
+    TEST_ASSERT_EQUAL(WIDTH, atlasTextWidth(atlas, "1234.56g"));
+
+    drawAtlasText(buffer, WIDTH, HEIGHT, atlas, 0, 30, "8");
+    const AtlasGlyph *eight = findAtlasGlyph(atlas, '8');
+    for (int x = 0; x < WIDTH; x++)
+    {
+        for (int y = 0; y < HEIGHT; y++)
+        {
+            bool inside = x >= eight->xOffset && x < eight->xOffset + eight->width && y >= 30 + eight->yOffset && y < 30;
+            if (!inside)
+            {
+                TEST_ASSERT_FALSE(pixel(x, y));
+            }
+        }
+    }
+    TEST_ASSERT_GREATER_THAN(eight->width * 2, countPixels());
+}
+
+void test_picks_largest_fitting_atlas(void)
+{
+    const GlyphAtlas *const atlases[] = {&roboto_mono_26_atlas, &roboto_mono_22_atlas, &roboto_mono_20_atlas};
+    // the atlases are named by point size at 100 dpi, where digits are about as many pixels tall
+    TEST_ASSERT_EQUAL(26, findAtlasGlyph(roboto_mono_26_atlas, '0')->height);
+    TEST_ASSERT_EQUAL(22, findAtlasGlyph(roboto_mono_22_atlas, '0')->height);
+    TEST_ASSERT_EQUAL(20, findAtlasGlyph(roboto_mono_20_atlas, '0')->height);
+
+    TEST_ASSERT_TRUE(fittingAtlas(atlases, 3, "36.00g", WIDTH) == &roboto_mono_26_atlas);
+    TEST_ASSERT_TRUE(fittingAtlas(atlases, 3, "-12.34g", WIDTH) == &roboto_mono_22_atlas);
+    TEST_ASSERT_TRUE(fittingAtlas(atlases, 3, "1234.56g", WIDTH) == &roboto_mono_20_atlas);
+    TEST_ASSERT_NULL(fittingAtlas(atlases, 3, "-1234.56g", WIDTH));
+    // the renderer drops the unit then
+    TEST_ASSERT_LESS_OR_EQUAL(WIDTH, atlasTextWidth(roboto_mono_20_atlas, "-1234.56"));
+    // the time is always drawn with the 22 pt atlas
+    TEST_ASSERT_LESS_OR_EQUAL(WIDTH, atlasTextWidth(roboto_mono_22_atlas, "59:59.9"));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_draws_aligned_glyph);
+    RUN_TEST(test_draws_unaligned_glyph_across_columns);
+    RUN_TEST(test_advances_and_skips_missing_characters);
+    RUN_TEST(test_clips_at_screen_edges);
+    RUN_TEST(test_generated_atlas_fits_weight_screen);
+    RUN_TEST(test_picks_largest_fitting_atlas);
+    UNITY_END();
+}
\ No newline at end of file
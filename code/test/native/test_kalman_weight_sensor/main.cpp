@@ -0,0 +1,126 @@
+#include <unity.h>
+#include <math.h>
+
+#include "kalman_weight_sensor.h"
+#include "mock/mock_loadcell.h"
+
+// 80 SPS like the HX711
+#define SAMPLE_INTERVAL_US 12500
+// 1000 raw per gram
+#define SCALE 0.001f
+
+KalmanWeightSensor *weightSensor;
+static uint32_t seed;
+static uint64_t timeUs;
+
+void setUp(void)
+{
+    weightSensor = new KalmanWeightSensor();
+    weightSensor->setScale(SCALE);
+    seed = 1;
+    timeUs = 1000000;
+}
+
+void tearDown(void)
+{
+    delete weightSensor;
+    LoadCell::timestampUs = 0;
+}
+
+static void addSample(float grams)
+{
+    // uniform noise of about 0.075g standard deviation
+    seed = seed * 1664525 + 1013904223;
+    long noise = (long)(seed >> 24) - 128;
+
+    LoadCell::value = lroundf(grams / SCALE) + noise;
+    LoadCell::timestampUs = timeUs;
+    LoadCell::ready = true;
+    weightSensor->update();
+    timeUs += SAMPLE_INTERVAL_US;
+}
+
+void test_first_sample_is_weight(void)
+{
+    addSample(12);
+    TEST_ASSERT_TRUE(weightSensor->isNewWeight());
+    TEST_ASSERT_FLOAT_WITHIN(0.13f, 12, weightSensor->getWeight());
+    TEST_ASSERT_EQUAL_FLOAT(0, weightSensor->getFlowRate());
+
+    weightSensor->update();
+    TEST_ASSERT_FALSE(weightSensor->isNewWeight());
+}
+
+void test_stable_weight_is_smoothed(void)
+{
+    float squaredError = 0;
+    for (int i = 0; i < 400; i++)
+    {
+        addSample(100);
+        if (i >= 80)
+        {
+            float error = weightSensor->getWeight() - 100;
+            squaredError += error * error;
+            TEST_ASSERT_FLOAT_WITHIN(0.5f, 0, weightSensor->getFlowRate());
+        }
+    }
+    // less than half the noise of a single sample
+    TEST_ASSERT_LESS_THAN(0.035f, sqrtf(squaredError / 320));
+}
+
+void test_tracks_constant_flow(void)
+{
+    for (int i = 0; i < 80; i++)
+    {
+        addSample(0);
+    }
+    // 2g/s for 3 seconds
+    for (int i = 0; i < 240; i++)
+    {
+        addSample(i * 2 * SAMPLE_INTERVAL_US / 1000000.0f);
+    }
+
+    TEST_ASSERT_FLOAT_WITHIN(0.2f, 2, weightSensor->getFlowRate());
+    TEST_ASSERT_FLOAT_WITHIN(0.1f, 239 * 2 * SAMPLE_INTERVAL_US / 1000000.0f, weightSensor->getWeight());
+}
+
+void test_step_restarts_filter(void)
+{
+    for (int i = 0; i < 80; i++)
+    {
+        addSample(0);
+    }
+    addSample(250);
+    TEST_ASSERT_FLOAT_WITHIN(0.13f, 250, weightSensor->getWeight());
+    TEST_ASSERT_EQUAL_FLOAT(0, weightSensor->getFlowRate());
+}
+
+void test_tare_and_scale(void)
+{
+    for (int i = 0; i < 80; i++)
+    {
+        addSample(300);
+    }
+    weightSensor->tare();
+    TEST_ASSERT_FLOAT_WITHIN(0.001f, 0, weightSensor->getWeight());
+    TEST_ASSERT_FLOAT_WITHIN(0.13f, 300, weightSensor->getLastUntaredWeight());
+
+    WeightSample sample = weightSensor->getLastSample();
+    TEST_ASSERT_EQUAL_UINT64(timeUs - SAMPLE_INTERVAL_US, sample.timestampUs);
+    TEST_ASSERT_EQUAL(LoadCell::value, sample.raw);
+    TEST_ASSERT_EQUAL(lroundf(weightSensor->getLastWeight() * 1000), sample.weightMg);
+
+    weightSensor->setScale(2 * SCALE);
+    TEST_ASSERT_FLOAT_WITHIN(0.26f, 600, weightSensor->getLastUntaredWeight());
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_first_sample_is_weight);
+    RUN_TEST(test_stable_weight_is_smoothed);
+    RUN_TEST(test_tracks_constant_flow);
+    RUN_TEST(test_step_restarts_filter);
+    RUN_TEST(test_tare_and_scale);
+    UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,122 @@
+#include <unity.h>
+#include <thread>
+
+#include "mailbox.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_empty(void)
+{
+    Mailbox<int> mailbox;
+    int value = 5;
+    TEST_ASSERT_FALSE(mailbox.hasNew());
+    TEST_ASSERT_FALSE(mailbox.take(value));
+    TEST_ASSERT_EQUAL(5, value);
+}
+
+void test_publish_take(void)
+{
+    Mailbox<int> mailbox;
+    mailbox.publish(1);
+    TEST_ASSERT_TRUE(mailbox.hasNew());
+
+    int value;
+    TEST_ASSERT_TRUE(mailbox.take(value));
+    TEST_ASSERT_EQUAL(1, value);
+
+    // a value is only taken once
+    TEST_ASSERT_FALSE(mailbox.hasNew());
+    TEST_ASSERT_FALSE(mailbox.take(value));
+}
+
+void test_keeps_latest(void)
+{
+    Mailbox<int> mailbox;
+    int value;
+    for (int i = 0; i < 10; i++)
+    {
+        mailbox.publish(i);
+    }
+    TEST_ASSERT_TRUE(mailbox.take(value));
+    TEST_ASSERT_EQUAL(9, value);
+
+    // alternate to cycle through all slots
+    for (int i = 10; i < 100; i++)
+    {
+        mailbox.publish(i);
+        mailbox.publish(i * 2);
+        TEST_ASSERT_TRUE(mailbox.take(value));
+        TEST_ASSERT_EQUAL(i * 2, value);
+    }
+}
+
+struct Snapshot
+{
+    uint32_t sequence;
+    uint32_t words[15];
+};
+
+void test_two_thread_stress(void)
+{
+    // snapshots must never be torn and the sequence must never go backwards
+    static Mailbox<Snapshot> mailbox;
+    const uint32_t count = 1000000;
+
+    std::thread producer([&]() {
+        Snapshot snapshot;
+        for (uint32_t i = 1; i <= count; i++)
+        {
+            snapshot.sequence = i;
+            for (int w = 0; w < 15; w++)
+            {
+                snapshot.words[w] = i * (w + 1);
+            }
+            mailbox.publish(snapshot);
+            if ((i & 0xff) == 0)
+            {
+                // let the consumer run when both threads share a core
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint32_t last = 0;
+    uint32_t taken = 0;
+    bool consistent = true;
+    while (last < count)
+    {
+        Snapshot snapshot;
+        if (mailbox.take(snapshot))
+        {
+            for (int w = 0; w < 15; w++)
+            {
+                consistent &= snapshot.words[w] == snapshot.sequence * (w + 1);
+            }
+            consistent &= snapshot.sequence > last;
+            last = snapshot.sequence;
+            taken++;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    TEST_ASSERT_TRUE(consistent);
+    TEST_ASSERT_EQUAL(count, last);
+    TEST_ASSERT_GREATER_THAN(0, taken);
+    TEST_ASSERT_FALSE(mailbox.hasNew());
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_empty);
+    RUN_TEST(test_publish_take);
+    RUN_TEST(test_keeps_latest);
+    RUN_TEST(test_two_thread_stress);
+    return UNITY_END();
+}
\ No newline at end of file
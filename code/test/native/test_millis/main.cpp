@@ -0,0 +1,69 @@
+#include <unity.h>
+
+#include "millis.h"
+#include "stopwatch.h"
+
+void setUp(void) { VirtualClock::reset(); }
+
+void tearDown(void) {}
+
+void test_starts_at_nonzero_time(void)
+{
+    TEST_ASSERT_EQUAL_UINT64(VIRTUAL_CLOCK_START_US, nowUs());
+    TEST_ASSERT_EQUAL_UINT64(VIRTUAL_CLOCK_START_US / 1000, now());
+}
+
+void test_only_moves_when_advanced(void)
+{
+    uint64_t start = nowUs();
+    TEST_ASSERT_EQUAL_UINT64(start, nowUs());
+
+    VirtualClock::advanceUs(250);
+    TEST_ASSERT_EQUAL_UINT64(start + 250, nowUs());
+
+    VirtualClock::advance(3);
+    TEST_ASSERT_EQUAL_UINT64(start + 3250, nowUs());
+}
+
+void test_sleep_advances_time(void)
+{
+    uint64_t start = now();
+    sleep_for(60 * 60 * 1000);
+    TEST_ASSERT_EQUAL_UINT64(start + 60 * 60 * 1000, now());
+}
+
+void test_run_for(void)
+{
+    uint64_t start = now();
+    int steps = 0;
+    VirtualClock::runFor([&]() { steps++; }, 1000, 10);
+
+    TEST_ASSERT_EQUAL(100, steps);
+    TEST_ASSERT_EQUAL_UINT64(start + 1000, now());
+}
+
+void test_run_until(void)
+{
+    Stopwatch stopwatch;
+    stopwatch.start();
+
+    // a ten minute scenario stepped every 12.5 ms, like the load cell at 80 SPS
+    bool done = VirtualClock::runUntil([]() {}, [&]() { return stopwatch.getTime() >= 10 * 60 * 1000; }, 20 * 60 * 1000, 12);
+    TEST_ASSERT_TRUE(done);
+    TEST_ASSERT_EQUAL(600000, stopwatch.getTime());
+
+    // gives up after the timeout
+    done = VirtualClock::runUntil([]() {}, []() { return false; }, 100);
+    TEST_ASSERT_FALSE(done);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_starts_at_nonzero_time);
+    RUN_TEST(test_only_moves_when_advanced);
+    RUN_TEST(test_sleep_advances_time);
+    RUN_TEST(test_run_for);
+    RUN_TEST(test_run_until);
+    UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include <unity.h>
+#include "modes/mode_calibrate.h"
+#include "mock/mock_interface.h"
+#include "mock/mock_display.h"
+#include "mock/mock_loadcell.h"
+#include "stopwatch.h"
+
+static Stopwatch *stopwatch;
+static DefaultWeightSensor *weightSensor;
+static ModeCalibration *modeCalibration;
+static float savedScale;
+
+static void saveScale(float scale)
+{
+    savedScale = scale;
+}
+
+void setUp(void)
+{
+    Display::reset();
+    Interface::reset();
+    savedScale = NAN;
+    stopwatch = new Stopwatch();
+    weightSensor = new DefaultWeightSensor();
+    modeCalibration = new ModeCalibration(*weightSensor, *stopwatch, saveScale);
+    modeCalibration->enter();
+}
+
+void tearDown(void)
+{
+    delete modeCalibration;
+    delete weightSensor;
+    delete stopwatch;
+}
+
+/**
+ * @brief Runs one loop like the firmware, the weight sensor reads the load cell before the mode is updated.
+ */
+static void loop(long raw, ClickType click = ClickType::NONE)
+{
+    LoadCell::value = raw;
+    LoadCell::ready = true;
+    weightSensor->update();
+    Interface::encoderClick = click;
+    modeCalibration->update();
+    Interface::encoderClick = ClickType::NONE;
+}
+
+void test_calibrates_from_weight_sensor_samples(void)
+{
+    loop(1000);
+    loop(1000, ClickType::SINGLE);
+    loop(51000, ClickType::SINGLE);
+    for (int i = 0; i < CALIBRATION_SAMPLE_SIZE; i++)
+    {
+        TEST_ASSERT_FALSE(modeCalibration->canSwitchMode());
+        loop(51000);
+    }
+
+    TEST_ASSERT_TRUE(modeCalibration->canSwitchMode());
+    TEST_ASSERT_EQUAL_FLOAT(DEFAULT_CALIBRATION_WEIGHT / 50000.0f, savedScale);
+}
+
+void test_ignores_samples_after_exit(void)
+{
+    loop(1000);
+    loop(1000, ClickType::SINGLE);
+    loop(51000, ClickType::SINGLE);
+    modeCalibration->exit();
+    for (int i = 0; i < CALIBRATION_SAMPLE_SIZE; i++)
+    {
+        loop(51000);
+    }
+
+    TEST_ASSERT_FALSE(modeCalibration->canSwitchMode());
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_calibrates_from_weight_sensor_samples);
+    RUN_TEST(test_ignores_samples_after_exit);
+    UNITY_END();
+}
\ No newline at end of file
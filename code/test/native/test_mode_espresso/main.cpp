@@ -5,8 +5,6 @@
 #include "stopwatch.h"
 #include <unity.h>
 
-#include <chrono>
-#include <thread>
 
 static MockWeightSensor *weightSensor;
 static Stopwatch *stopwatch;
@@ -20,6 +18,7 @@ void setUp(void)
     weightSensor = new MockWeightSensor();
     stopwatch = new Stopwatch();
     modeEspresso = new ModeEspresso(*weightSensor, *stopwatch);
+    modeEspresso->enter();
 }
 
 void tearDown(void)
@@ -31,32 +30,38 @@ void tearDown(void)
 void test_encoder_adjusts_target_weight(void)
 {
     modeEspresso->update();
+    modeEspresso->draw();
     uint32_t targetWeight = Display::espressoTargetWeightMg;
 
     // turn encoder right increases weighht by 0.1g per tick
     Interface::encoderTicks = 5;
     modeEspresso->update();
+    modeEspresso->draw();
     TEST_ASSERT_EQUAL(targetWeight + 500, Display::espressoTargetWeightMg);
 
     // turn encoder left decreases weight by 0.1g per tick
     Interface::encoderTicks = -10;
     modeEspresso->update();
+    modeEspresso->draw();
     TEST_ASSERT_EQUAL(targetWeight - 500, Display::espressoTargetWeightMg);
 }
 
 void test_encoder_clamps_weight_between_min_and_max(void)
 {
     modeEspresso->update();
+    modeEspresso->draw();
     uint32_t targetWeight = Display::espressoTargetWeightMg;
 
     // turn encoder left
     Interface::encoderTicks = -100000;
     modeEspresso->update();
+    modeEspresso->draw();
     TEST_ASSERT_EQUAL(MIN_TARGET_WEIGHT_MG, Display::espressoTargetWeightMg);
 
     // turn encoder right
     Interface::encoderTicks = 1000000;
     modeEspresso->update();
+    modeEspresso->draw();
     TEST_ASSERT_EQUAL(MAX_TARGET_WEIGHT_MG, Display::espressoTargetWeightMg);
 }
 
@@ -64,16 +69,19 @@ void test_clicking_encoder_starts_stopwatch(void)
 {
     // initially time on watch is 0
     modeEspresso->update();
+    modeEspresso->draw();
     TEST_ASSERT_EQUAL(0, Display::espressoCurrentTimeMs);
 
     // click encoder to start stopwatch
     Interface::encoderClick = ClickType::SINGLE;
     modeEspresso->update();
+    modeEspresso->draw();
     TEST_ASSERT_TRUE(stopwatch->isRunning());
 
     // click again to stop stopwatch
     Interface::encoderClick = ClickType::SINGLE;
     modeEspresso->update();
+    modeEspresso->draw();
     TEST_ASSERT_FALSE(stopwatch->isRunning());
 }
 
@@ -81,9 +89,47 @@ void test_display_shows_current_weight(void)
 {
     weightSensor->weight = 10;
     modeEspresso->update();
+    modeEspresso->draw();
     TEST_ASSERT_EQUAL(10 * 1000, Display::espressoCurrentWeightMg);
 }
 
+void test_stopwatch_stops_at_sample_capture_time(void)
+{
+    Interface::encoderClick = ClickType::SINGLE;
+    modeEspresso->update();
+    modeEspresso->draw();
+    Interface::encoderClick = ClickType::NONE;
+    uint64_t start = nowUs();
+
+    // target weight reached by a sample captured 500 ms after the start,
+    // but only processed later
+    sleep_for(5);
+    weightSensor->weight = 100;
+    weightSensor->newWeight = true;
+    weightSensor->timestampUs = start + 500000;
+    weightSensor->update();
+    modeEspresso->update();
+    modeEspresso->draw();
+
+    TEST_ASSERT_FALSE(stopwatch->isRunning());
+    TEST_ASSERT_EQUAL(500, stopwatch->getTime());
+}
+
+void test_ignores_samples_after_exit(void)
+{
+    Interface::encoderClick = ClickType::SINGLE;
+    modeEspresso->update();
+    Interface::encoderClick = ClickType::NONE;
+
+    modeEspresso->exit();
+    weightSensor->weight = 100;
+    weightSensor->newWeight = true;
+    weightSensor->update();
+    modeEspresso->update();
+
+    TEST_ASSERT_TRUE(stopwatch->isRunning());
+}
+
 int main(void)
 {
     UNITY_BEGIN();
@@ -91,5 +137,7 @@ int main(void)
     RUN_TEST(test_clicking_encoder_starts_stopwatch);
     RUN_TEST(test_encoder_clamps_weight_between_min_and_max);
     RUN_TEST(test_display_shows_current_weight);
+    RUN_TEST(test_stopwatch_stops_at_sample_capture_time);
+    RUN_TEST(test_ignores_samples_after_exit);
     UNITY_END();
 }
\ No newline at end of file
@@ -16,6 +16,14 @@ public:
     {
         updateCalled = true;
     };
+    void draw()
+    {
+        drawCalled = true;
+    };
+    void exit()
+    {
+        exitCalled = true;
+    };
     bool canSwitchMode()
     {
         return switchable;
@@ -25,6 +33,8 @@ public:
         return name;
     };
     bool updateCalled;
+    bool drawCalled = false;
+    bool exitCalled = false;
     const char *name;
     bool switchable = true;
 };
@@ -58,16 +68,27 @@ void enterSelection()
 {
     Interface::encoderClick = ClickType::LONG;
     modeManager->update();
+    modeManager->draw();
     Interface::encoderClick = ClickType::NONE;
     modeManager->update();
+    modeManager->draw();
 }
 
 void test_mode_manager_updates_current_mode_by_default(void)
 {
     modeManager->update();
+    modeManager->draw();
     TEST_ASSERT_TRUE(mockModes[0]->updateCalled);
 }
 
+void test_mode_manager_draws_current_mode(void)
+{
+    modeManager->update();
+    TEST_ASSERT_FALSE(mockModes[0]->drawCalled);
+    modeManager->draw();
+    TEST_ASSERT_TRUE(mockModes[0]->drawCalled);
+}
+
 void test_mode_manager_shows_current_mode_after_long_click(void)
 {
     enterSelection();
@@ -81,10 +102,12 @@ void test_mode_manager_shows_next_and_previous_mode_after_rotation(void)
 
     Interface::encoderDirection = Interface::EncoderDirection::CW;
     modeManager->update();
+    modeManager->draw();
     TEST_ASSERT_EQUAL_STRING("Mock Mode 2", Display::lastModeText);
 
     Interface::encoderDirection = Interface::EncoderDirection::CCW;
     modeManager->update();
+    modeManager->draw();
     TEST_ASSERT_EQUAL_STRING("Mock Mode 1", Display::lastModeText);
 }
 
@@ -95,6 +118,7 @@ void test_mode_manager_modes_lower_bound(void)
 
     Interface::encoderDirection = Interface::EncoderDirection::CCW;
     modeManager->update();
+    modeManager->draw();
     TEST_ASSERT_EQUAL_STRING("Mock Mode 1", Display::lastModeText);
 }
 
@@ -105,14 +129,17 @@ void test_mode_manager_modes_upper_bound(void)
 
     Interface::encoderDirection = Interface::EncoderDirection::CW;
     modeManager->update();
+    modeManager->draw();
     TEST_ASSERT_EQUAL_STRING("Mock Mode 2", Display::lastModeText);
 
     Interface::encoderDirection = Interface::EncoderDirection::CW;
     modeManager->update();
+    modeManager->draw();
     TEST_ASSERT_EQUAL_STRING("Mock Mode 3", Display::lastModeText);
 
     Interface::encoderDirection = Interface::EncoderDirection::CW;
     modeManager->update();
+    modeManager->draw();
     TEST_ASSERT_EQUAL_STRING("Mock Mode 3", Display::lastModeText);
 }
 
@@ -123,8 +150,11 @@ void test_mode_manager_does_not_call_update_when_changing(void)
 
     // some updates
     modeManager->update();
+    modeManager->draw();
     modeManager->update();
+    modeManager->draw();
     modeManager->update();
+    modeManager->draw();
 
     TEST_ASSERT_FALSE(mockModes[0]->updateCalled);
     TEST_ASSERT_FALSE(mockModes[1]->updateCalled);
@@ -138,13 +168,16 @@ void test_mode_manager_selects_mode_with_single_click(void)
 
     Interface::encoderDirection = Interface::EncoderDirection::CW;
     modeManager->update();
+    modeManager->draw();
     Interface::encoderDirection = Interface::EncoderDirection::NONE;
     TEST_ASSERT_EQUAL_STRING("Mock Mode 2", Display::lastModeText);
 
     Interface::encoderClick = ClickType::SINGLE;
     modeManager->update();
+    modeManager->draw();
     Interface::encoderClick = ClickType::NONE;
     modeManager->update();
+    modeManager->draw();
     TEST_ASSERT_TRUE(mockModes[1]->updateCalled);
 }
 
@@ -163,20 +196,36 @@ void test_mode_manager_updates_next_mode_only_at_next_tick(void)
 
     Interface::encoderDirection = Interface::EncoderDirection::CW;
     modeManager->update();
+    modeManager->draw();
     Interface::encoderDirection = Interface::EncoderDirection::NONE;
     TEST_ASSERT_EQUAL_STRING("Mock Mode 2", Display::lastModeText);
 
     Interface::encoderClick = ClickType::SINGLE;
     modeManager->update();
+    modeManager->draw();
     TEST_ASSERT_FALSE(mockModes[1]->updateCalled);
     modeManager->update();
+    modeManager->draw();
     TEST_ASSERT_TRUE(mockModes[1]->updateCalled);
 }
 
+void test_mode_manager_exits_mode_when_changing(void)
+{
+    mockModes[0]->switchable = false;
+    enterSelection();
+    TEST_ASSERT_FALSE(mockModes[0]->exitCalled);
+
+    mockModes[0]->switchable = true;
+    enterSelection();
+    TEST_ASSERT_TRUE(mockModes[0]->exitCalled);
+    TEST_ASSERT_FALSE(mockModes[1]->exitCalled);
+}
+
 int main(void)
 {
     UNITY_BEGIN();
     RUN_TEST(test_mode_manager_updates_current_mode_by_default);
+    RUN_TEST(test_mode_manager_draws_current_mode);
     RUN_TEST(test_mode_manager_shows_current_mode_after_long_click);
     RUN_TEST(test_mode_manager_shows_next_and_previous_mode_after_rotation);
     RUN_TEST(test_mode_manager_modes_lower_bound);
@@ -184,5 +233,6 @@ int main(void)
     RUN_TEST(test_mode_manager_does_not_call_update_when_changing);
     RUN_TEST(test_mode_manager_selects_mode_with_single_click);
     RUN_TEST(test_mode_manager_can_only_switch_when_mode_allows_it);
+    RUN_TEST(test_mode_manager_exits_mode_when_changing);
     UNITY_END();
 }
\ No newline at end of file
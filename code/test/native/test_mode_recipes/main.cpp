@@ -64,52 +64,64 @@ void test_steps_forward_and_back(void)
     TEST_ASSERT_EQUAL(0, modeRecipes->getCurrentStepIndex());
     Interface::encoderClick = ClickType::SINGLE;
     modeRecipes->update();
+    modeRecipes->draw();
 
     TEST_ASSERT_EQUAL(1, modeRecipes->getCurrentStepIndex());
     Interface::encoderClick = ClickType::SINGLE;
     modeRecipes->update();
+    modeRecipes->draw();
 
     TEST_ASSERT_EQUAL(2, modeRecipes->getCurrentStepIndex());
     Interface::encoderClick = ClickType::SINGLE;
     modeRecipes->update();
+    modeRecipes->draw();
 
     TEST_ASSERT_EQUAL(3, modeRecipes->getCurrentStepIndex());
     Interface::encoderClick = ClickType::SINGLE;
     modeRecipes->update();
+    modeRecipes->draw();
 
     TEST_ASSERT_EQUAL(4, modeRecipes->getCurrentStepIndex());
     Interface::encoderClick = ClickType::SINGLE;
     modeRecipes->update();
+    modeRecipes->draw();
 
     TEST_ASSERT_EQUAL(5, modeRecipes->getCurrentStepIndex());
     Interface::encoderClick = ClickType::SINGLE;
     modeRecipes->update();
+    modeRecipes->draw();
 
     // Should not go further, as timer did not expire yet
 
     TEST_ASSERT_EQUAL(5, modeRecipes->getCurrentStepIndex());
     Interface::encoderClick = ClickType::LONG;
     modeRecipes->update();
+    modeRecipes->draw();
 
     TEST_ASSERT_EQUAL(4, modeRecipes->getCurrentStepIndex());
     Interface::encoderClick = ClickType::LONG;
     modeRecipes->update();
+    modeRecipes->draw();
 
     TEST_ASSERT_EQUAL(3, modeRecipes->getCurrentStepIndex());
     Interface::encoderClick = ClickType::LONG;
     modeRecipes->update();
+    modeRecipes->draw();
 
     TEST_ASSERT_EQUAL(2, modeRecipes->getCurrentStepIndex());
     Interface::encoderClick = ClickType::LONG;
     modeRecipes->update();
+    modeRecipes->draw();
 
     TEST_ASSERT_EQUAL(1, modeRecipes->getCurrentStepIndex());
     Interface::encoderClick = ClickType::LONG;
     modeRecipes->update();
+    modeRecipes->draw();
 
     TEST_ASSERT_EQUAL(0, modeRecipes->getCurrentStepIndex());
     Interface::encoderClick = ClickType::LONG;
     modeRecipes->update();
+    modeRecipes->draw();
 
     TEST_ASSERT_EQUAL(0, modeRecipes->getCurrentStepIndex());
 }
@@ -118,6 +130,7 @@ void nextStep()
 {
     Interface::encoderClick = ClickType::SINGLE;
     modeRecipes->update();
+    modeRecipes->draw();
 }
 
 void test_issue_25(void)
@@ -133,6 +146,7 @@ void test_issue_25(void)
     // adjust ratio
     Interface::encoderTicks = 10;
     modeRecipes->update();
+    modeRecipes->draw();
 
     // next step
     nextStep();
@@ -141,6 +155,7 @@ void test_issue_25(void)
     // go back
     Interface::encoderClick = ClickType::LONG;
     modeRecipes->update();
+    modeRecipes->draw();
     TEST_ASSERT_EQUAL(2, modeRecipes->getCurrentStepIndex());
 
     // go forward again
@@ -5,8 +5,6 @@
 #include "mock/mock_display.h"
 #include "stopwatch.h"
 
-#include <chrono>
-#include <thread>
 
 static Stopwatch *stopwatch;
 static MockWeightSensor *weightSensor;
@@ -16,6 +14,7 @@ ModeScale *modeScale;
 void setUp(void)
 {
     Display::reset();
+    Interface::reset();
     stopwatch = new Stopwatch();
     weightSensor = new MockWeightSensor();
     modeScale = new ModeScale(*weightSensor, *stopwatch);
@@ -33,6 +32,7 @@ void test_stopwatch_start_when_click(void)
     TEST_ASSERT_FALSE(stopwatch->isRunning());
     Interface::encoderClick = ClickType::SINGLE;
     modeScale->update();
+    modeScale->draw();
     TEST_ASSERT_TRUE(stopwatch->isRunning());
 }
 
@@ -40,7 +40,9 @@ void test_stopwatch_stop_when_click_again(void)
 {
     Interface::encoderClick = ClickType::SINGLE;
     modeScale->update();
+    modeScale->draw();
     modeScale->update();
+    modeScale->draw();
     TEST_ASSERT_FALSE(stopwatch->isRunning());
 }
 
@@ -50,6 +52,7 @@ void test_loadcell_tare_when_encoder_rotated(void)
 
     Interface::encoderDirection = Interface::EncoderDirection::CW;
     modeScale->update();
+    modeScale->draw();
     TEST_ASSERT_EQUAL(0, weightSensor->getWeight());
 }
 
@@ -58,15 +61,17 @@ void test_display_shows_weight(void)
     weightSensor->weight = 1;
 
     modeScale->update();
-    TEST_ASSERT_EQUAL(1.0, Display::weight);
+    modeScale->draw();
+    TEST_ASSERT_EQUAL(1000, Display::weightMg);
 }
 
 void test_display_shows_time(void)
 {
     stopwatch->start();
-    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    sleep_for(2);
     modeScale->update();
-    TEST_ASSERT_GREATER_OR_EQUAL(2, Display::time);
+    modeScale->draw();
+    TEST_ASSERT_EQUAL(2, Display::time);
 }
 
 int main(void)
@@ -100,6 +100,80 @@ void test_size_variable(void)
     TEST_ASSERT_EQUAL_FLOAT(50, result.yIntercept);
 }
 
+void test_more_than_255_points(void)
+{
+    // the buffer size must not be truncated to 8 bits
+    Regression::Approximator largeApproximation(300);
+
+    double sumX = 0, sumY = 0, sumX2 = 0, sumXY = 0;
+    for (int i = 0; i < 300; i++)
+    {
+        Regression::Point p = {i, i < 150 ? 0.0f : 2.0f * (i - 150)};
+        largeApproximation.addPoint(p);
+        sumX += p.x;
+        sumY += p.y;
+        sumX2 += (double)p.x * p.x;
+        sumXY += p.x * p.y;
+    }
+
+    double m = (300 * sumXY - sumX * sumY) / (300 * sumX2 - sumX * sumX);
+    double yIntercept = (sumY - m * sumX) / 300;
+
+    auto result = largeApproximation.getLeastSquares();
+    TEST_ASSERT_FLOAT_WITHIN(0.001, m, result.m);
+    TEST_ASSERT_FLOAT_WITHIN(0.1, yIntercept, result.yIntercept);
+}
+
+void test_long_shot(void)
+{
+    // x * x of times past ~46s overflows 32 bit, results must still be exact
+    const Regression::Point points[] = {
+        {60000, 120001},
+        {60100, 120201},
+        {60200, 120401},
+        {60300, 120601},
+    };
+
+    assertSlope(points, 2, 1);
+    TEST_ASSERT_EQUAL(61000, approximation.getXAtY(122001));
+}
+
+void test_sliding_window_matches_full_scan(void)
+{
+    Regression::Approximator windowApproximation(7);
+    Regression::Point points[40];
+    for (int i = 0; i < 40; i++)
+    {
+        // irregular spacing and noisy weights, starting late in a shot
+        points[i] = {100000 + i * 97 + (i * 31) % 13, (float)(3 * i + (i * 17) % 5)};
+        windowApproximation.addPoint(points[i]);
+
+        // reference least squares over the last 7 points
+        int first = i < 6 ? 0 : i - 6;
+        double n = i - first + 1, sumX = 0, sumY = 0, sumX2 = 0, sumXY = 0;
+        for (int j = first; j <= i; j++)
+        {
+            double x = points[j].x - points[first].x;
+            sumX += x;
+            sumY += points[j].y;
+            sumX2 += x * x;
+            sumXY += x * points[j].y;
+        }
+
+        if (n < 2)
+        {
+            continue;
+        }
+
+        double m = (n * sumXY - sumX * sumY) / (n * sumX2 - sumX * sumX);
+        double yIntercept = (sumY - m * sumX) / n - m * points[first].x;
+
+        auto result = windowApproximation.getLeastSquares();
+        TEST_ASSERT_FLOAT_WITHIN(0.00001, m, result.m);
+        TEST_ASSERT_FLOAT_WITHIN(0.01, yIntercept, result.yIntercept);
+    }
+}
+
 void test_x_at_y(void)
 {
     const Regression::Point points[] = {
@@ -113,6 +187,57 @@ void test_x_at_y(void)
     TEST_ASSERT_EQUAL(3, x);
 }
 
+void test_quadratic_x_at_y(void)
+{
+    Regression::QuadraticApproximator quadratic(50);
+    // y = 3 * t^2 + 2 * t + 1, with t in seconds, starting late in a shot
+    for (int i = 0; i < 30; i++)
+    {
+        double t = 60 + i * 0.1;
+        quadratic.addPoint({60000 + i * 100, (float)(3 * t * t + 2 * t + 1)});
+    }
+
+    // y at t = 65s
+    TEST_ASSERT_EQUAL(65000, quadratic.getXAtY(3 * 65 * 65 + 2 * 65 + 1));
+}
+
+void test_quadratic_sliding_window(void)
+{
+    Regression::QuadraticApproximator quadratic(10);
+    // first a line that leaves the window, then a tapering curve y = -t^2 + 20t with t in seconds
+    for (int i = 0; i < 20; i++)
+    {
+        quadratic.addPoint({i * 100, (float)(i * 1000)});
+    }
+    for (int i = 20; i < 60; i++)
+    {
+        double t = i * 0.1;
+        quadratic.addPoint({i * 100, (float)(-t * t + 20 * t)});
+    }
+
+    // y = 96 is reached at t = 8s
+    TEST_ASSERT_EQUAL(8000, quadratic.getXAtY(96));
+    // the curve peaks at y = 100 for t = 10s, a higher y falls back to the linear fit
+    auto linear = quadratic.getLeastSquares();
+    TEST_ASSERT_EQUAL(quadratic.getXAtY(150, linear), quadratic.getXAtY(150));
+}
+
+void test_quadratic_falls_back_to_linear(void)
+{
+    Regression::QuadraticApproximator quadratic(20);
+    // two points are not enough for a quadratic fit
+    quadratic.addPoint({0, 1});
+    quadratic.addPoint({1, 3});
+    TEST_ASSERT_EQUAL(3, quadratic.getXAtY(7));
+
+    // all points at the same x are degenerate
+    quadratic.reset();
+    quadratic.addPoint({1000, 1});
+    quadratic.addPoint({1000, 2});
+    quadratic.addPoint({1000, 3});
+    TEST_ASSERT_EQUAL(LONG_MAX, quadratic.getXAtY(7));
+}
+
 void test_empty(void)
 {
     auto result = approximation.getLeastSquares();
@@ -127,7 +252,13 @@ int main(void)
     RUN_TEST(test_not_full);
     RUN_TEST(test_overflow_buffer);
     RUN_TEST(test_size_variable);
+    RUN_TEST(test_more_than_255_points);
+    RUN_TEST(test_long_shot);
+    RUN_TEST(test_sliding_window_matches_full_scan);
     RUN_TEST(test_x_at_y);
     RUN_TEST(test_empty);
+    RUN_TEST(test_quadratic_x_at_y);
+    RUN_TEST(test_quadratic_sliding_window);
+    RUN_TEST(test_quadratic_falls_back_to_linear);
     return UNITY_END();
 }
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include <unity.h>
+
+#include "millis.h"
+#include "render_scheduler.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_first_frame_is_drawn(void)
+{
+    RenderScheduler scheduler(10);
+    TEST_ASSERT_TRUE(scheduler.shouldDraw());
+    TEST_ASSERT_FALSE(scheduler.shouldDraw());
+}
+
+void test_draws_at_target_fps(void)
+{
+    RenderScheduler scheduler(10);
+
+    // loop runs every ms for one second
+    int frames = 0;
+    VirtualClock::runFor([&]() { frames += scheduler.shouldDraw(); }, 1000);
+    TEST_ASSERT_EQUAL(10, frames);
+}
+
+void test_redraw_request_draws_immediately(void)
+{
+    RenderScheduler scheduler(10);
+    scheduler.shouldDraw();
+    sleep_for(1);
+    TEST_ASSERT_FALSE(scheduler.shouldDraw());
+
+    scheduler.requestRedraw();
+    TEST_ASSERT_TRUE(scheduler.shouldDraw());
+    // starts a new frame interval
+    sleep_for(99);
+    TEST_ASSERT_FALSE(scheduler.shouldDraw());
+    sleep_for(1);
+    TEST_ASSERT_TRUE(scheduler.shouldDraw());
+}
+
+void test_set_target_fps(void)
+{
+    RenderScheduler scheduler(10);
+    scheduler.setTargetFps(50);
+    scheduler.shouldDraw();
+    sleep_for(20);
+    TEST_ASSERT_TRUE(scheduler.shouldDraw());
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_first_frame_is_drawn);
+    RUN_TEST(test_draws_at_target_fps);
+    RUN_TEST(test_redraw_request_draws_immediately);
+    RUN_TEST(test_set_target_fps);
+    UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,173 @@
+#include <unity.h>
+#include <cstdio>
+#include <math.h>
+#include <vector>
+
+#include "regression.h"
+
+#define TARGET_WEIGHT_MG 36000
+#define SAMPLE_INTERVAL_MS 100
+// predictions are only shown after the grace period, errors before are not relevant
+#define GRACE_PERIOD_MS 1000
+// evaluate the last seconds before the target is reached, this is where the prediction matters most
+#define EVALUATION_WINDOW_MS 10000
+
+/**
+ * A shot as a sequence of (time in ms, weight in mg) points.
+ *
+ * There are no recorded shots yet, the traces are synthetic, generated from flow profiles of typical
+ * shots with deterministic noise.
+ */
+struct ShotTrace
+{
+    const char *name;
+    std::vector<Regression::Point> points;
+    long finishTimeMs;
+};
+
+typedef float (*FlowProfile)(float seconds);
+
+// pre-infusion, then steady flow
+static float flowSteady(float s) { return s < 6 ? 0 : (s < 9 ? (s - 6) / 3 * 1.6f : 1.6f); }
+// flow increases late in the shot, e.g. due to channeling
+static float flowLateIncrease(float s) { return s < 6 ? 0 : (s < 9 ? (s - 6) / 3 * 1.3f : (s < 18 ? 1.3f : 2.4f)); }
+// flow ramps up after pre-infusion and tapers off towards the end
+static float flowTapering(float s) { return s < 5 ? 0 : (s < 12 ? (s - 5) / 7 * 2.2f : 2.2f - (s - 12) * 0.04f); }
+
+static ShotTrace generateTrace(const char *name, FlowProfile flow)
+{
+    ShotTrace trace = {name, {}, -1};
+    float weightMg = 0;
+    uint32_t seed = 12345;
+
+    for (long t = 0; t < 120000; t += SAMPLE_INTERVAL_MS)
+    {
+        weightMg += flow(t / 1000.0f) * SAMPLE_INTERVAL_MS;
+
+        // +-150mg noise
+        seed = seed * 1664525 + 1013904223;
+        float noise = (int)(seed >> 24) - 128;
+        float measured = (int)(weightMg + noise * 150 / 128);
+
+        trace.points.push_back({t, measured});
+        if (weightMg >= TARGET_WEIGHT_MG)
+        {
+            trace.finishTimeMs = t;
+            break;
+        }
+    }
+
+    return trace;
+}
+
+/**
+ * Replays a trace into the estimator like ModeEspresso does and returns the mean absolute error of the
+ * predicted finish time in the evaluation window, NAN if the trace has no point to evaluate.
+ */
+static float replay(const ShotTrace &trace, Regression::Estimator &estimator)
+{
+    estimator.reset();
+    if (trace.finishTimeMs < 0)
+    {
+        return NAN;
+    }
+
+    float sumError = 0;
+    unsigned int count = 0;
+    for (auto p : trace.points)
+    {
+        estimator.addPoint(p);
+        long estimatedTime = estimator.getXAtY(TARGET_WEIGHT_MG);
+
+        if (p.x >= GRACE_PERIOD_MS && p.x >= trace.finishTimeMs - EVALUATION_WINDOW_MS)
+        {
+            sumError += abs(estimatedTime - trace.finishTimeMs);
+            count++;
+        }
+    }
+
+    // traces ending before the grace period have nothing to evaluate
+    return count > 0 ? sumError / count : NAN;
+}
+
+static std::vector<ShotTrace> traces;
+
+void setUp(void)
+{
+    if (traces.empty())
+    {
+        traces.push_back(generateTrace("steady", flowSteady));
+        traces.push_back(generateTrace("late increase", flowLateIncrease));
+        traces.push_back(generateTrace("tapering", flowTapering));
+    }
+}
+
+void test_traces_reach_target(void)
+{
+    for (auto &trace : traces)
+    {
+        TEST_ASSERT_GREATER_THAN(0, trace.finishTimeMs);
+    }
+}
+
+void test_prediction_error(void)
+{
+    Regression::Approximator approximator(50);
+    Regression::RecursiveEstimator recursive(0.9f);
+    Regression::QuadraticApproximator quadratic(50);
+
+    for (auto &trace : traces)
+    {
+        float approximatorError = replay(trace, approximator);
+        float recursiveError = replay(trace, recursive);
+        float quadraticError = replay(trace, quadratic);
+
+        printf("%-16s finish %6ld ms | approximator(50) %7.0f ms | recursive(0.9) %7.0f ms | quadratic(50) %7.0f ms\n", trace.name,
+               trace.finishTimeMs, approximatorError, recursiveError, quadraticError);
+
+        // all estimators must stay within a few seconds in the last seconds of a shot
+        TEST_ASSERT_FALSE(isnan(approximatorError));
+        TEST_ASSERT_FALSE(isnan(recursiveError));
+        TEST_ASSERT_FALSE(isnan(quadraticError));
+        TEST_ASSERT_LESS_THAN_FLOAT(5000, approximatorError);
+        TEST_ASSERT_LESS_THAN_FLOAT(5000, recursiveError);
+        TEST_ASSERT_LESS_THAN_FLOAT(5000, quadraticError);
+    }
+}
+
+void test_recursive_without_forgetting_is_least_squares(void)
+{
+    // with a forgetting factor of 1, recursive least squares converges to the least squares solution
+    Regression::Approximator approximator(REGRESSION_MAX_POINTS);
+    Regression::RecursiveEstimator recursive(1.0f);
+
+    for (auto p : traces[0].points)
+    {
+        approximator.addPoint(p);
+        recursive.addPoint(p);
+    }
+
+    auto expected = approximator.getLeastSquares();
+    auto result = recursive.getLeastSquares();
+    TEST_ASSERT_FLOAT_WITHIN(0.0001, expected.m, result.m);
+    TEST_ASSERT_FLOAT_WITHIN(1, expected.yIntercept, result.yIntercept);
+}
+
+void test_replay_without_evaluated_points(void)
+{
+    Regression::Approximator approximator(50);
+    ShotTrace empty = {"empty", {}, -1};
+    TEST_ASSERT_FLOAT_IS_NAN(replay(empty, approximator));
+    ShotTrace early = {"early", {{0, 0}, {100, 40000}}, 100};
+    TEST_ASSERT_FLOAT_IS_NAN(replay(early, approximator));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_traces_reach_target);
+    RUN_TEST(test_prediction_error);
+    RUN_TEST(test_recursive_without_forgetting_is_least_squares);
+    RUN_TEST(test_replay_without_evaluated_points);
+    return UNITY_END();
+}
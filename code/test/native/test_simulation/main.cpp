@@ -0,0 +1,156 @@
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "simulator.h"
+#include "millis.h"
+#include "settings.h"
+#include "mock/mock_display.h"
+#include "mock/mock_interface.h"
+
+using namespace Simulation;
+
+// 80 SPS like the HX711
+#define SAMPLE_INTERVAL_US 12500
+// 1000 raw per gram
+#define SCALE 0.001f
+
+static const Interface::EncoderDirection NO_DIRECTION = Interface::EncoderDirection::NONE;
+static const Interface::EncoderDirection CW = Interface::EncoderDirection::CW;
+
+void setUp(void) { VirtualClock::reset(); }
+
+void tearDown(void) {}
+
+/**
+ * @brief Builds a trace from a function of time in seconds to grams, with deterministic noise.
+ */
+template <typename Grams>
+static std::vector<TraceSample> makeTrace(float durationS, Grams grams)
+{
+    std::vector<TraceSample> trace;
+    uint32_t seed = 1;
+    for (uint64_t timeUs = 0; timeUs < durationS * 1000000; timeUs += SAMPLE_INTERVAL_US)
+    {
+        seed = seed * 1664525 + 1013904223;
+        long noise = (long)(seed >> 24) - 128;
+        trace.push_back({timeUs, (long)(grams(timeUs / 1000000.0f) / SCALE) + noise});
+    }
+    return trace;
+}
+
+static uint64_t firstTimeAbove(const std::vector<TraceSample> &trace, float grams)
+{
+    for (const TraceSample &sample : trace)
+    {
+        if (sample.raw * SCALE >= grams)
+        {
+            return sample.timeUs;
+        }
+    }
+    return 0;
+}
+
+static void runTargetReachedToStopwatchStopped(SensorModel sensorModel)
+{
+    // espresso shot starting at 4s with 2g/s, the default target is 36g
+    std::vector<TraceSample> trace = makeTrace(40, [](float t) { return t < 4 ? 0 : (t - 4) * 2; });
+    std::vector<InputEvent> inputs = {
+        // switch to espresso mode and start the stopwatch
+        {1000, ClickType::LONG, NO_DIRECTION, 0},
+        {1100, ClickType::NONE, CW, 0},
+        {1200, ClickType::NONE, CW, 0},
+        {1300, ClickType::SINGLE, NO_DIRECTION, 0},
+        {2000, ClickType::SINGLE, NO_DIRECTION, 0},
+    };
+
+    Simulator simulator(trace, inputs, SCALE, sensorModel);
+    simulator.begin();
+    TEST_ASSERT_TRUE(simulator.runUntil([&]() { return simulator.stopwatch.isRunning(); }, 5000));
+    uint64_t startUs = simulator.getTimeUs();
+
+    TEST_ASSERT_TRUE(simulator.runUntil([&]() { return !simulator.stopwatch.isRunning(); }, 60000));
+    // the stopwatch stops at the capture time of the sample that reached the target
+    uint64_t reachedUs = startUs + simulator.stopwatch.getTime() * 1000;
+    uint64_t latencyUs = simulator.getTimeUs() - reachedUs;
+    printf("target reached -> stopwatch stopped: %llu us\n", (unsigned long long)latencyUs);
+
+    // the stopwatch time has ms resolution
+    TEST_ASSERT_LESS_OR_EQUAL(SIMULATION_LOOP_INTERVAL_US + 1000, latencyUs);
+    // noise and the tare offset shift the crossing by a few samples
+    TEST_ASSERT_UINT_WITHIN(100000, firstTimeAbove(trace, 36), reachedUs);
+
+    // every display call is recorded in order
+    TEST_ASSERT_GREATER_THAN(0, Display::calls.size());
+    bool sawModeSwitcher = false;
+    bool sawEspressoShot = false;
+    for (size_t i = 0; i < Display::calls.size(); i++)
+    {
+        sawModeSwitcher |= strcmp(Display::calls[i].function, "modeSwitcher") == 0;
+        sawEspressoShot |= sawModeSwitcher && strcmp(Display::calls[i].function, "espressoShot") == 0;
+        if (i > 0)
+        {
+            TEST_ASSERT_GREATER_OR_EQUAL(Display::calls[i - 1].timeUs, Display::calls[i].timeUs);
+        }
+    }
+    TEST_ASSERT_TRUE(sawModeSwitcher);
+    TEST_ASSERT_TRUE(sawEspressoShot);
+}
+
+void test_target_reached_to_stopwatch_stopped(void) { runTargetReachedToStopwatchStopped(SensorModel::AVERAGING); }
+
+void test_target_reached_to_stopwatch_stopped_kalman(void) { runTargetReachedToStopwatchStopped(SensorModel::KALMAN); }
+
+static void runCupPlacedToAutoTare(SensorModel sensorModel)
+{
+    Settings::setFloat(Settings::AUTO_TARE_0, 250);
+    Settings::setFloat(Settings::AUTO_TARE_TOLERANCE, 2);
+
+    // a 250g cup is placed after 5s
+    std::vector<TraceSample> trace = makeTrace(10, [](float t) { return t < 5 ? 0 : 250; });
+    std::vector<InputEvent> inputs;
+
+    Simulator simulator(trace, inputs, SCALE, sensorModel);
+    simulator.begin();
+    TEST_ASSERT_TRUE(simulator.runUntil([]() { return Interface::buzzerToneCount > 0; }, 10000));
+
+    uint64_t latencyUs = simulator.getTimeUs() - firstTimeAbove(trace, 125);
+    printf("cup placed -> auto tare: %llu us\n", (unsigned long long)latencyUs);
+
+    // the auto tare buffer needs 16 stable samples
+    TEST_ASSERT_LESS_OR_EQUAL(16 * SAMPLE_INTERVAL_US + SIMULATION_LOOP_INTERVAL_US, latencyUs);
+    simulator.runFor(100);
+    TEST_ASSERT_FLOAT_WITHIN(1, 0, simulator.weightSensor.getWeight());
+
+    Settings::setFloat(Settings::AUTO_TARE_0, 0);
+    Settings::setFloat(Settings::AUTO_TARE_TOLERANCE, 0);
+}
+
+void test_cup_placed_to_auto_tare(void) { runCupPlacedToAutoTare(SensorModel::AVERAGING); }
+
+void test_cup_placed_to_auto_tare_kalman(void) { runCupPlacedToAutoTare(SensorModel::KALMAN); }
+
+void test_read_trace(void)
+{
+    FILE *file = tmpfile();
+    fputs("# time_us,raw\n0,100\n12500,-200\n", file);
+    rewind(file);
+
+    std::vector<TraceSample> trace = readTrace(file);
+    fclose(file);
+
+    TEST_ASSERT_EQUAL(2, trace.size());
+    TEST_ASSERT_EQUAL_UINT64(12500, trace[1].timeUs);
+    TEST_ASSERT_EQUAL(-200, trace[1].raw);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_target_reached_to_stopwatch_stopped);
+    RUN_TEST(test_target_reached_to_stopwatch_stopped_kalman);
+    RUN_TEST(test_cup_placed_to_auto_tare);
+    RUN_TEST(test_cup_placed_to_auto_tare_kalman);
+    RUN_TEST(test_read_trace);
+    UNITY_END();
+}
\ No newline at end of file
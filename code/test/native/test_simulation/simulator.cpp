@@ -0,0 +1,136 @@
+#include <math.h>
+
+#include "simulator.h"
+#include "data/recipes.h"
+#include "millis.h"
+#include "mock/mock_display.h"
+#include "mock/mock_interface.h"
+#include "mock/mock_loadcell.h"
+
+namespace Simulation
+{
+    static void saveScale(float scale) {}
+
+    std::vector<TraceSample> readTrace(FILE *file)
+    {
+        std::vector<TraceSample> trace;
+        char line[64];
+        while (fgets(line, sizeof(line), file))
+        {
+            unsigned long long timeUs;
+            long raw;
+            if (line[0] != '#' && sscanf(line, "%llu,%ld", &timeUs, &raw) == 2)
+            {
+                trace.push_back({timeUs, raw});
+            }
+        }
+        return trace;
+    }
+
+    Simulator::Simulator(const std::vector<TraceSample> &trace, const std::vector<InputEvent> &inputs,
+                         float scale, SensorModel sensorModel, uint64_t loopIntervalUs)
+        : weightSensor(sensorModel == SensorModel::KALMAN ? static_cast<WeightSensor &>(kalmanWeightSensor) : averagingWeightSensor),
+          trace(trace), inputs(inputs), loopIntervalUs(loopIntervalUs), startUs(nowUs()),
+          modeScale(weightSensor, stopwatch),
+          modeRecipes(weightSensor, RECIPES, RECIPE_COUNT),
+          modeEspresso(weightSensor, stopwatch),
+          modeCalibration(weightSensor, stopwatch, saveScale),
+          modes{&modeScale, &modeRecipes, &modeEspresso, &modeCalibration, &modeSettings},
+          modeManager(modes, 5)
+    {
+        Display::reset();
+        Display::recordCalls = true;
+        Interface::reset();
+        LoadCell::ready = false;
+
+        weightSensor.setScale(scale);
+        weightSensor.setAutoAveraging(fabs(1 / scale), 64);
+    }
+
+    void Simulator::begin()
+    {
+        for (int i = 0; i < SIMULATION_TARE_SAMPLES && !isTraceDone();)
+        {
+            feedLoadCell();
+            weightSensor.update();
+            if (weightSensor.isNewWeight())
+            {
+                i++;
+            }
+            VirtualClock::advanceUs(loopIntervalUs);
+        }
+        weightSensor.tare();
+
+        modeManager.begin();
+    }
+
+    void Simulator::step()
+    {
+        feedLoadCell();
+        if (applyInputs())
+        {
+            renderScheduler.requestRedraw();
+        }
+
+        Interface::update();
+        weightSensor.update();
+        modeManager.update();
+        if (renderScheduler.shouldDraw())
+        {
+            modeManager.draw();
+        }
+        Display::update();
+
+        // clicks and directions are only seen by one loop
+        Interface::encoderClick = ClickType::NONE;
+        Interface::encoderDirection = Interface::EncoderDirection::NONE;
+
+        VirtualClock::advanceUs(loopIntervalUs);
+    }
+
+    void Simulator::runFor(uint64_t durationMs)
+    {
+        uint64_t endUs = getTimeUs() + durationMs * 1000;
+        while (getTimeUs() < endUs)
+        {
+            step();
+        }
+    }
+
+    uint64_t Simulator::getTimeUs() { return nowUs() - startUs; }
+
+    bool Simulator::isTraceDone() { return nextSample >= trace.size(); }
+
+    void Simulator::feedLoadCell()
+    {
+        // the mock holds a single sample, like the HX711 when it is read in time
+        while (nextSample < trace.size() && trace[nextSample].timeUs <= getTimeUs())
+        {
+            LoadCell::value = trace[nextSample].raw;
+            LoadCell::timestampUs = startUs + trace[nextSample].timeUs;
+            LoadCell::ready = true;
+            nextSample++;
+        }
+    }
+
+    bool Simulator::applyInputs()
+    {
+        bool applied = false;
+        while (nextInput < inputs.size() && inputs[nextInput].timeMs * 1000 <= getTimeUs())
+        {
+            const InputEvent &input = inputs[nextInput];
+            if (input.click != ClickType::NONE)
+            {
+                Interface::encoderClick = input.click;
+            }
+            if (input.direction != Interface::EncoderDirection::NONE)
+            {
+                Interface::encoderDirection = input.direction;
+            }
+            Interface::encoderTicks += input.encoderTicks;
+            nextInput++;
+            applied = true;
+        }
+        return applied;
+    }
+}
\ No newline at end of file
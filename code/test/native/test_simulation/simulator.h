@@ -0,0 +1,138 @@
+#pragma once
+
+#include <stdio.h>
+#include <vector>
+
+#include "interface.h"
+#include "mode_manager.h"
+#include "modes/mode_calibrate.h"
+#include "modes/mode_espresso.h"
+#include "modes/mode_recipe.h"
+#include "modes/mode_scale.h"
+#include "modes/mode_settings.h"
+#include "render_scheduler.h"
+#include "kalman_weight_sensor.h"
+#include "stopwatch.h"
+#include "weight_sensor.h"
+
+// faster than the HX711 at 80 SPS, so every sample is seen by its own loop
+#define SIMULATION_LOOP_INTERVAL_US 1000
+#define SIMULATION_TARE_SAMPLES 32
+
+namespace Simulation
+{
+    /**
+     * @brief Raw load cell value, captured at a time relative to the start of the simulation.
+     */
+    struct TraceSample
+    {
+        uint64_t timeUs;
+        long raw;
+    };
+
+    /**
+     * @brief Input applied at a time relative to the start of the simulation.
+     *
+     * Clicks and directions last for one loop like the real encoder, ticks accumulate
+     * until a mode resets them.
+     */
+    struct InputEvent
+    {
+        uint64_t timeMs;
+        ClickType click;
+        Interface::EncoderDirection direction;
+        long encoderTicks;
+    };
+
+    /**
+     * @brief Weight sensor the firmware runs with, KALMAN is the WEIGHT_KALMAN build.
+     */
+    enum class SensorModel
+    {
+        AVERAGING,
+        KALMAN
+    };
+
+    /**
+     * @brief Reads a trace with one "time_us,raw" pair per line, lines starting with # are skipped.
+     */
+    std::vector<TraceSample> readTrace(FILE *file);
+
+    /**
+     * @brief Runs the firmware main loop against a load cell trace and scripted inputs.
+     *
+     * Wires the same modes as main.cpp. Time is taken from VirtualClock, so scenarios
+     * replay as fast as the firmware code runs. Display calls are recorded in Display::calls.
+     */
+    class Simulator
+    {
+    public:
+        Simulator(const std::vector<TraceSample> &trace, const std::vector<InputEvent> &inputs,
+                  float scale = 1.0f, SensorModel sensorModel = SensorModel::AVERAGING,
+                  uint64_t loopIntervalUs = SIMULATION_LOOP_INTERVAL_US);
+        /**
+         * @brief Same as setup() in main.cpp, tares after SIMULATION_TARE_SAMPLES samples.
+         */
+        void begin();
+        /**
+         * @brief Runs one iteration of the main loop and advances the clock by the loop interval.
+         */
+        void step();
+        void runFor(uint64_t durationMs);
+        /**
+         * @brief Steps until done returns true.
+         *
+         * @return false if done did not return true within timeoutMs
+         */
+        template <typename Condition>
+        bool runUntil(Condition done, uint64_t timeoutMs)
+        {
+            uint64_t endUs = getTimeUs() + timeoutMs * 1000;
+            while (!done())
+            {
+                if (getTimeUs() >= endUs)
+                {
+                    return false;
+                }
+                step();
+            }
+            return true;
+        }
+        /**
+         * @brief Time since the start of the simulation in microseconds.
+         */
+        uint64_t getTimeUs();
+        bool isTraceDone();
+
+        DefaultWeightSensor averagingWeightSensor;
+        KalmanWeightSensor kalmanWeightSensor;
+        /**
+         * @brief The sensor selected by the sensor model, used by all modes.
+         */
+        WeightSensor &weightSensor;
+        Stopwatch stopwatch;
+        RenderScheduler renderScheduler;
+
+    private:
+        std::vector<TraceSample> trace;
+        std::vector<InputEvent> inputs;
+        uint64_t loopIntervalUs;
+        uint64_t startUs;
+        size_t nextSample = 0;
+        size_t nextInput = 0;
+
+        ModeScale modeScale;
+        ModeRecipes modeRecipes;
+        ModeEspresso modeEspresso;
+        ModeCalibration modeCalibration;
+        ModeSettings modeSettings;
+        Mode *modes[5];
+        ModeManager modeManager;
+
+        void feedLoadCell();
+        /**
+         * @brief Applies inputs that are due, returns true if there were any.
+         */
+        bool applyInputs();
+    };
+}
\ No newline at end of file
@@ -0,0 +1,82 @@
+#include <unity.h>
+
+#include "filter_chain.h"
+#include "weight_sensor.h"
+#include "mock/mock_loadcell.h"
+
+void setUp(void) {}
+
+void tearDown(void)
+{
+    LoadCell::timestampUs = 0;
+}
+
+static long randomValue(uint32_t &seed, long range)
+{
+    seed = seed * 1664525 + 1013904223;
+    return (long)(seed >> 8) % range - range / 2;
+}
+
+template <uint8_t N>
+static void assertSameAsSortedMedian(long range)
+{
+    Median<N> expected;
+    SlidingMedian<N> median;
+    uint32_t seed = N;
+    for (int i = 0; i < 2000; i++)
+    {
+        long value = randomValue(seed, range);
+        TEST_ASSERT_EQUAL(expected.process(value, 0), median.process(value, 0));
+    }
+}
+
+void test_same_as_sorted_median(void)
+{
+    assertSameAsSortedMedian<1>(1000);
+    assertSameAsSortedMedian<2>(1000);
+    assertSameAsSortedMedian<5>(1000);
+    assertSameAsSortedMedian<16>(1000);
+    assertSameAsSortedMedian<63>(1000000);
+    // many duplicates
+    assertSameAsSortedMedian<7>(3);
+    assertSameAsSortedMedian<32>(4);
+}
+
+void test_rejects_spikes(void)
+{
+    SlidingMedian<5> median;
+    for (int i = 0; i < 10; i++)
+    {
+        median.process(100 + i, 0);
+    }
+    TEST_ASSERT_EQUAL(108, median.process(50000, 0));
+    TEST_ASSERT_EQUAL(108, median.process(-50000, 0));
+    TEST_ASSERT_EQUAL(109, median.process(112, 0));
+
+    median.reset();
+    TEST_ASSERT_EQUAL(-1, median.process(-1, 0));
+}
+
+void test_weight_sensor_rejects_spike_before_averaging(void)
+{
+    FilteredWeightSensor<FilterChain<SlidingMedian<5>, AdaptiveAverage<AVERAGING_MAX_SAMPLES>>> weightSensor;
+    weightSensor.setAutoAveraging(1000, 4);
+    for (int i = 0; i < 8; i++)
+    {
+        LoadCell::value = i == 5 ? 100000 : 1000;
+        LoadCell::timestampUs = 1000000 + i * 12500;
+        LoadCell::ready = true;
+        weightSensor.update();
+        // the knock never reaches the average
+        TEST_ASSERT_EQUAL(1000, weightSensor.getRawWeight());
+    }
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_same_as_sorted_median);
+    RUN_TEST(test_rejects_spikes);
+    RUN_TEST(test_weight_sensor_rejects_spike_before_averaging);
+    return UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,116 @@
+#include <unity.h>
+#include <thread>
+
+#include "spsc_queue.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_push_pop(void)
+{
+    SpscQueue<int, 4> queue;
+    TEST_ASSERT_TRUE(queue.isEmpty());
+
+    TEST_ASSERT_TRUE(queue.push(1));
+    TEST_ASSERT_TRUE(queue.push(2));
+    TEST_ASSERT_EQUAL(2, queue.size());
+
+    int value = -1;
+    TEST_ASSERT_TRUE(queue.pop(value));
+    TEST_ASSERT_EQUAL(1, value);
+    TEST_ASSERT_TRUE(queue.pop(value));
+    TEST_ASSERT_EQUAL(2, value);
+    TEST_ASSERT_FALSE(queue.pop(value));
+    TEST_ASSERT_TRUE(queue.isEmpty());
+}
+
+void test_full_queue_drops(void)
+{
+    SpscQueue<int, 4> queue;
+    for (int i = 0; i < 4; i++)
+    {
+        TEST_ASSERT_TRUE(queue.push(i));
+    }
+    TEST_ASSERT_FALSE(queue.push(4));
+    TEST_ASSERT_EQUAL(4, queue.size());
+
+    // oldest values are kept
+    int value = -1;
+    queue.pop(value);
+    TEST_ASSERT_EQUAL(0, value);
+    TEST_ASSERT_TRUE(queue.push(5));
+}
+
+void test_wrap_around(void)
+{
+    SpscQueue<int, 4> queue;
+    int value = -1;
+    for (int i = 0; i < 100; i++)
+    {
+        queue.push(i);
+        queue.push(i + 1000);
+        TEST_ASSERT_TRUE(queue.pop(value));
+        TEST_ASSERT_EQUAL(i, value);
+        TEST_ASSERT_TRUE(queue.pop(value));
+        TEST_ASSERT_EQUAL(i + 1000, value);
+    }
+}
+
+struct Sample
+{
+    uint64_t timestamp;
+    long value;
+};
+
+void test_two_thread_stress(void)
+{
+    // producer and consumer on different threads, every value must arrive exactly once and in order
+    static SpscQueue<Sample, 32> queue;
+    const uint32_t count = 2000000;
+
+    std::thread producer([&]() {
+        for (uint32_t i = 0; i < count;)
+        {
+            if (queue.push({i, (long)i * 3}))
+            {
+                i++;
+            }
+            else
+            {
+                // let the consumer run when both threads share a core
+                std::this_thread::yield();
+            }
+        }
+    });
+
+    uint32_t expected = 0;
+    bool inOrder = true;
+    while (expected < count)
+    {
+        Sample sample;
+        if (queue.pop(sample))
+        {
+            inOrder &= sample.timestamp == expected && sample.value == (long)expected * 3;
+            expected++;
+        }
+        else
+        {
+            std::this_thread::yield();
+        }
+    }
+    producer.join();
+
+    TEST_ASSERT_TRUE(inOrder);
+    TEST_ASSERT_TRUE(queue.isEmpty());
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_push_pop);
+    RUN_TEST(test_full_queue_drops);
+    RUN_TEST(test_wrap_around);
+    RUN_TEST(test_two_thread_stress);
+    return UNITY_END();
+}
@@ -43,6 +43,7 @@ void test_can_step_forward(void)
         }};
     setRecipe(singlePourRecipe);
     recipeBrewing->update();
+    recipeBrewing->draw();
 
     // can only step forward if all pours are done
     // pour not yet done, cant forward
@@ -51,6 +52,7 @@ void test_can_step_forward(void)
     // wait for pour done
     sleep_for(201);
     recipeBrewing->update();
+    recipeBrewing->draw();
 
     // last pour done, can forward
     TEST_ASSERT_TRUE(recipeBrewing->canStepForward());
@@ -71,6 +73,7 @@ void test_recipe_brewing(void)
                            }};
     setRecipe(recipe);
     recipeBrewing->update();
+    recipeBrewing->draw();
 
     // brewing recipe
     // 2 pours with 2 and 3 times coffee weight as water respectively
@@ -83,6 +86,7 @@ void test_recipe_brewing(void)
     // still pour time not pause time
     sleep_for(201);
     recipeBrewing->update();
+    recipeBrewing->draw();
     TEST_ASSERT_LESS_THAN(300, Display::recipeTimeToFinishMs);
     TEST_ASSERT_GREATER_THAN(200, Display::recipeTimeToFinishMs);
     TEST_ASSERT_FALSE(Display::recipeIsPause);
@@ -90,6 +94,7 @@ void test_recipe_brewing(void)
     // wait another ~300ms
     sleep_for(301);
     recipeBrewing->update();
+    recipeBrewing->draw();
     // now pause has started, 300ms pause time
     TEST_ASSERT_TRUE(Display::recipeIsPause);
     TEST_ASSERT_LESS_THAN(300, Display::recipeTimeToFinishMs);
@@ -98,14 +103,17 @@ void test_recipe_brewing(void)
     // wait another ~300ms
     sleep_for(301);
     recipeBrewing->update();
+    recipeBrewing->draw();
     // now time should be 0
     TEST_ASSERT_EQUAL(0, Display::recipeTimeToFinishMs);
 
     // next step reached by single click
     Interface::encoderClick = ClickType::SINGLE;
     recipeBrewing->update();
+    recipeBrewing->draw();
     Interface::encoderClick = ClickType::NONE;
     recipeBrewing->update();
+    recipeBrewing->draw();
 
     // verify that second step has started
     // as loadcell always returns 0, total missing weight is now the
@@ -119,6 +127,7 @@ void test_recipe_brewing(void)
     // after 300ms, recipe should be done
     sleep_for(301);
     recipeBrewing->update();
+    recipeBrewing->draw();
     TEST_ASSERT_EQUAL(0, Display::recipeTimeToFinishMs);
 }
 
@@ -138,17 +147,20 @@ void test_recipe_auto_advances_step_when_flag_is_set(void)
         }};
     setRecipe(autoAdvanceRecipe);
     recipeBrewing->update();
+    recipeBrewing->draw();
 
     // verify that first step is running
     TEST_ASSERT_EQUAL(0, recipeBrewing->recipePourIndex);
     // wait 100ms for completion
     sleep_for(101);
     recipeBrewing->update();
+    recipeBrewing->draw();
     // verify that second step has started
     TEST_ASSERT_EQUAL(1, recipeBrewing->recipePourIndex);
     // wait again 100ms for completion
     sleep_for(101);
     recipeBrewing->update();
+    recipeBrewing->draw();
     // next step does not auto advance, so we should still see the second step
     TEST_ASSERT_EQUAL(1, recipeBrewing->recipePourIndex);
 }
@@ -169,6 +181,7 @@ void test_recipe_auto_starts_when_flag_is_enbled(void)
         }};
     setRecipe(autoAdvanceRecipe);
     recipeBrewing->update();
+    recipeBrewing->draw();
 
     // verify that first step is running, as it is auto started
     TEST_ASSERT_EQUAL(0, recipeBrewing->recipePourIndex);
@@ -176,23 +189,28 @@ void test_recipe_auto_starts_when_flag_is_enbled(void)
     sleep_for(101);
     // auto advances to next step
     recipeBrewing->update();
+    recipeBrewing->draw();
 
     // second step does not auto start, recipe should display time to finish
     recipeBrewing->update();
+    recipeBrewing->draw();
     TEST_ASSERT_EQUAL(50, Display::recipeTimeToFinishMs);
     sleep_for(101);
     recipeBrewing->update();
+    recipeBrewing->draw();
     // even after 100ms, still 50ms to go
     TEST_ASSERT_EQUAL(50, Display::recipeTimeToFinishMs);
 
     // only after clicking encoder we should see the next step
     Interface::encoderClick = ClickType::SINGLE;
     recipeBrewing->update();
+    recipeBrewing->draw();
     Interface::encoderClick = ClickType::NONE;
 
     // verify that step has started after clicking
     sleep_for(10);
     recipeBrewing->update();
+    recipeBrewing->draw();
     TEST_ASSERT_LESS_OR_EQUAL(40, Display::recipeTimeToFinishMs);
 }
 
@@ -210,6 +228,7 @@ void test_recipe_shows_pause_time_when_auto_start_disabled_and_pour_time_0(void)
         }};
     setRecipe(autoAdvanceRecipe);
     recipeBrewing->update();
+    recipeBrewing->draw();
 
     // verify that the remaining time is shown
     TEST_ASSERT_EQUAL(50, Display::recipeTimeToFinishMs);
@@ -230,18 +249,22 @@ void test_advance_to_next_pour_via_click(void)
     }};
     setRecipe(recipe);
     recipeBrewing->update();
+    recipeBrewing->draw();
 
     TEST_ASSERT_EQUAL(0, recipeBrewing->recipePourIndex);
     recipeBrewing->update();
+    recipeBrewing->draw();
 
     // click encoder to start
     Interface::encoderClick = ClickType::SINGLE;
     recipeBrewing->update();
+    recipeBrewing->draw();
     Interface::encoderClick = ClickType::NONE;
 
     // wait 50ms for completion
     sleep_for(51);
     recipeBrewing->update();
+    recipeBrewing->draw();
 
     // still in first step
     TEST_ASSERT_EQUAL(0, recipeBrewing->recipePourIndex);
@@ -249,6 +272,7 @@ void test_advance_to_next_pour_via_click(void)
     // click encoder to advance to next step
     Interface::encoderClick = ClickType::SINGLE;
     recipeBrewing->update();
+    recipeBrewing->draw();
     Interface::encoderClick = ClickType::NONE;
 
     // verify that second step has started
@@ -271,21 +295,26 @@ void test_force_advance_to_next_pour_via_click(void)
         }};
     setRecipe(autoAdvanceRecipe);
     recipeBrewing->update();
+    recipeBrewing->draw();
 
     TEST_ASSERT_EQUAL(0, recipeBrewing->recipePourIndex);
     recipeBrewing->update();
+    recipeBrewing->draw();
 
     // click encoder to start
     Interface::encoderClick = ClickType::SINGLE;
     recipeBrewing->update();
+    recipeBrewing->draw();
     Interface::encoderClick = ClickType::NONE;
 
     TEST_ASSERT_EQUAL(0, recipeBrewing->recipePourIndex);
     recipeBrewing->update();
+    recipeBrewing->draw();
 
     // click again to force next step
     Interface::encoderClick = ClickType::SINGLE;
     recipeBrewing->update();
+    recipeBrewing->draw();
     Interface::encoderClick = ClickType::NONE;
 
     TEST_ASSERT_EQUAL(1, recipeBrewing->recipePourIndex);
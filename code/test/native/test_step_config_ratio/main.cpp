@@ -38,6 +38,7 @@ void test_adjust_ratio_via_encoder()
                            }};
     setRecipe(recipe);
     configRatio->update();
+    configRatio->draw();
 
     // initial ratio is as given in the recipe, i.e. 1 gram of coffee to 5 grams water
     // ratios must be divided by 100 to get the actual ratio
@@ -47,24 +48,29 @@ void test_adjust_ratio_via_encoder()
     // by turning encoder, ratio can be adjusted in steps of 0.1
     Interface::encoderTicks = 1;
     configRatio->update();
+    configRatio->draw();
     TEST_ASSERT_EQUAL(51, Display::ratioWater);
     Interface::encoderTicks = -1;
     configRatio->update();
+    configRatio->draw();
     TEST_ASSERT_EQUAL(49, Display::ratioWater);
 
     // ratio can not be reduced below 1:1
     Interface::encoderTicks = -10000;
     configRatio->update();
+    configRatio->draw();
     TEST_ASSERT_EQUAL(10, Display::ratioWater);
 
     // maxium ratio is limited by 64
     Interface::encoderTicks = 10000;
     configRatio->update();
+    configRatio->draw();
     TEST_ASSERT_EQUAL(640 + 50, Display::ratioWater);
 
     // return to normal ratio
     Interface::encoderTicks = 0;
     configRatio->update();
+    configRatio->draw();
     TEST_ASSERT_EQUAL(50, Display::ratioWater);
 }
 
@@ -81,10 +87,12 @@ void test_adjusting_ratio_affects_pour_ratios()
                            }};
     setRecipe(recipe);
     configRatio->update();
+    configRatio->draw();
 
     // increase ratio by 5, changing the ratio from 5 to 10 -> 2x
     Interface::encoderTicks = 50;
     configRatio->update();
+    configRatio->draw();
 
     // when config is finished, ratio should be adjusted
     configRatio->exit();
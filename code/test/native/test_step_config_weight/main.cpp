@@ -40,6 +40,7 @@ void test_adjust_weight_via_encoder()
                                      }};
     setRecipe(recipe);
     configWeight->update();
+    configWeight->draw();
 
     // initial coffee weight is 3 grams
     TEST_ASSERT_EQUAL(3000, Display::weightConfigWeightMg);
@@ -50,6 +51,7 @@ void test_adjust_weight_via_encoder()
     // turning encoder left should decrease
     Interface::encoderTicks = -1;
     configWeight->update();
+    configWeight->draw();
     TEST_ASSERT_EQUAL(2000, Display::weightConfigWeightMg);
     TEST_ASSERT_EQUAL(2000, recipeStepState.configRecipe.coffeeWeightMg);
     TEST_ASSERT_EQUAL(10, Display::weightConfigWaterWeightMl);
@@ -57,6 +59,7 @@ void test_adjust_weight_via_encoder()
     // cant reduce to 0 or below
     Interface::encoderTicks = -3;
     configWeight->update();
+    configWeight->draw();
     TEST_ASSERT_EQUAL(1000, Display::weightConfigWeightMg);
     TEST_ASSERT_EQUAL(1000, recipeStepState.configRecipe.coffeeWeightMg);
     TEST_ASSERT_EQUAL(5, Display::weightConfigWaterWeightMl);
@@ -41,6 +41,7 @@ void test_displays_current_weight_and_target_coffee_weight()
                            }};
     setRecipe(recipe);
     prepare->update();
+    prepare->draw();
 
     // should show required weight and current weight
     TEST_ASSERT_EQUAL(3000, Display::recipeInsertRequiredWeightMg);
@@ -49,6 +50,7 @@ void test_displays_current_weight_and_target_coffee_weight()
     weightSensor->weight = 1000;
     weightSensor->newWeight = true;
     prepare->update();
+    prepare->draw();
 
     // should show required weight and current weight
     TEST_ASSERT_EQUAL(3000, Display::recipeInsertRequiredWeightMg);
@@ -31,6 +31,7 @@ void tearDown(void)
 void test_encoder_rotation_changes_chosen_recipe()
 {
     switcherStep->update();
+    switcherStep->draw();
 
     // initial recipe is number 0
     TEST_ASSERT_EQUAL(0, Display::switcherIndex);
@@ -38,26 +39,31 @@ void test_encoder_rotation_changes_chosen_recipe()
     // turning encoder to left should remain at 0
     Interface::encoderDirection = Interface::EncoderDirection::CCW;
     switcherStep->update();
+    switcherStep->draw();
     TEST_ASSERT_EQUAL(0, Display::switcherIndex);
 
     // turning encoder to right should change to 1
     Interface::encoderDirection = Interface::EncoderDirection::CW;
     switcherStep->update();
+    switcherStep->draw();
     TEST_ASSERT_EQUAL(1, Display::switcherIndex);
 
     // turning encoder to right should change to 2
     Interface::encoderDirection = Interface::EncoderDirection::CW;
     switcherStep->update();
+    switcherStep->draw();
     TEST_ASSERT_EQUAL(2, Display::switcherIndex);
 
     // turning encoder to right should remain at 2
     Interface::encoderDirection = Interface::EncoderDirection::CW;
     switcherStep->update();
+    switcherStep->draw();
     TEST_ASSERT_EQUAL(2, Display::switcherIndex);
 
     // turning encoder to left should change to 1
     Interface::encoderDirection = Interface::EncoderDirection::CCW;
     switcherStep->update();
+    switcherStep->draw();
     TEST_ASSERT_EQUAL(1, Display::switcherIndex);
 }
 
@@ -65,6 +71,7 @@ void test_switcher_sets_recipe_state_to_chosen_recipe(void)
 {
     switcherStep->recipeIndex = 1;
     switcherStep->update();
+    switcherStep->draw();
     switcherStep->exit();
 
     TEST_ASSERT_EQUAL_STRING(RECIPES[1].name, recipeStepState.configRecipe.name);
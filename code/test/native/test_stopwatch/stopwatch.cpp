@@ -1,8 +1,6 @@
 #include "unity.h"
 #include "stopwatch.h"
-
-#include <chrono>
-#include <thread>
+#include "millis.h"
 
 void setUp(void) {}
 
@@ -13,18 +11,18 @@ void test_stopwatch_start(void)
     Stopwatch stopwatch;
     stopwatch.start();
     TEST_ASSERT_TRUE(stopwatch.isRunning());
-    std::this_thread::sleep_for(std::chrono::milliseconds(2));
-    TEST_ASSERT_GREATER_OR_EQUAL(2, stopwatch.getTime());
+    sleep_for(2);
+    TEST_ASSERT_EQUAL(2, stopwatch.getTime());
 }
 
 void test_stopwatch_stop(void)
 {
     Stopwatch stopwatch;
     stopwatch.start();
-    std::this_thread::sleep_for(std::chrono::milliseconds(2));
+    sleep_for(2);
     stopwatch.stop();
     TEST_ASSERT_FALSE(stopwatch.isRunning());
-    TEST_ASSERT_GREATER_OR_EQUAL(2, stopwatch.getTime());
+    TEST_ASSERT_EQUAL(2, stopwatch.getTime());
 }
 
 void test_stopwatch_toggle(void)
@@ -32,12 +30,12 @@ void test_stopwatch_toggle(void)
     Stopwatch stopwatch;
     stopwatch.toggle();
     TEST_ASSERT_TRUE(stopwatch.isRunning());
-    std::this_thread::sleep_for(std::chrono::milliseconds(2));
-    TEST_ASSERT_GREATER_OR_EQUAL(2, stopwatch.getTime());
+    sleep_for(2);
+    TEST_ASSERT_EQUAL(2, stopwatch.getTime());
     stopwatch.toggle();
     TEST_ASSERT_FALSE(stopwatch.isRunning());
-    std::this_thread::sleep_for(std::chrono::milliseconds(2));
-    TEST_ASSERT_GREATER_OR_EQUAL(2, stopwatch.getTime());
+    sleep_for(2);
+    TEST_ASSERT_EQUAL(2, stopwatch.getTime());
 }
 
 void test_stopwatch_reset(void)
@@ -56,6 +54,27 @@ void test_stopwatch_getTime(void)
     stopwatch.start();
 }
 
+void test_stopwatch_stop_at_time(void)
+{
+    Stopwatch stopwatch;
+    stopwatch.start();
+    uint64_t start = nowUs();
+    sleep_for(5);
+    stopwatch.stop(start + 2000);
+    TEST_ASSERT_FALSE(stopwatch.isRunning());
+    TEST_ASSERT_EQUAL(2, stopwatch.getTime());
+}
+
+void test_stopwatch_getTimeAt(void)
+{
+    Stopwatch stopwatch;
+    stopwatch.start();
+    uint64_t start = nowUs();
+    TEST_ASSERT_EQUAL(100, stopwatch.getTimeAt(start + 100000));
+    // times before the start are clamped
+    TEST_ASSERT_EQUAL(0, stopwatch.getTimeAt(start - 100000));
+}
+
 int main(void)
 {
     UNITY_BEGIN();
@@ -64,5 +83,7 @@ int main(void)
     RUN_TEST(test_stopwatch_toggle);
     RUN_TEST(test_stopwatch_reset);
     RUN_TEST(test_stopwatch_getTime);
+    RUN_TEST(test_stopwatch_stop_at_time);
+    RUN_TEST(test_stopwatch_getTimeAt);
     UNITY_END();
 }
\ No newline at end of file
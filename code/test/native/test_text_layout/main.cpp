@@ -0,0 +1,161 @@
+#include <unity.h>
+#include <string.h>
+
+#include "text_layout.h"
+
+#define CHAR_WIDTH 6
+
+static const char FONT[] = "font";
+static const char OTHER_FONT[] = "other";
+static int measured;
+
+void setUp(void) { measured = 0; }
+
+void tearDown(void) {}
+
+static int measure(const char *text)
+{
+    measured++;
+    return strlen(text) * CHAR_WIDTH;
+}
+
+void test_wrap_words(void)
+{
+    TextLayout layout;
+    // 60 px wide fits 9 characters plus a space
+    TEST_ASSERT_TRUE(layout.wrap("one two three four", FONT, 0, 60, measure));
+
+    TEST_ASSERT_EQUAL(4, layout.getRunCount());
+    TEST_ASSERT_EQUAL_STRING("one", layout.getRun(0).text);
+    TEST_ASSERT_EQUAL(0, layout.getRun(0).x);
+    TEST_ASSERT_EQUAL(0, layout.getRun(0).line);
+    TEST_ASSERT_EQUAL_STRING("two", layout.getRun(1).text);
+    TEST_ASSERT_EQUAL(24, layout.getRun(1).x);
+    TEST_ASSERT_EQUAL(0, layout.getRun(1).line);
+    TEST_ASSERT_EQUAL_STRING("three", layout.getRun(2).text);
+    TEST_ASSERT_EQUAL(0, layout.getRun(2).x);
+    TEST_ASSERT_EQUAL(1, layout.getRun(2).line);
+    TEST_ASSERT_EQUAL_STRING("four", layout.getRun(3).text);
+    TEST_ASSERT_EQUAL(1, layout.getRun(3).line);
+}
+
+void test_wrap_starts_at_left(void)
+{
+    TextLayout layout;
+    layout.wrap("aaaa bbbb", FONT, 10, 60, measure);
+    TEST_ASSERT_EQUAL(10, layout.getRun(0).x);
+    // 10 + 24 + 6 + 24 passes 60
+    TEST_ASSERT_EQUAL(10, layout.getRun(1).x);
+    TEST_ASSERT_EQUAL(1, layout.getRun(1).line);
+}
+
+void test_repeated_delimiters_are_skipped(void)
+{
+    TextLayout layout;
+    layout.wrap("  a   b ", FONT, 0, 100, measure);
+    TEST_ASSERT_EQUAL(2, layout.getRunCount());
+    TEST_ASSERT_EQUAL_STRING("a", layout.getRun(0).text);
+    TEST_ASSERT_EQUAL_STRING("b", layout.getRun(1).text);
+}
+
+void test_layout_is_cached(void)
+{
+    TextLayout layout;
+    char text[] = "pour slowly in circles";
+    TEST_ASSERT_TRUE(layout.wrap(text, FONT, 0, 60, measure));
+    int firstMeasured = measured;
+
+    // same content from another buffer is still cached
+    char copy[sizeof(text)];
+    strcpy(copy, text);
+    TEST_ASSERT_FALSE(layout.wrap(copy, FONT, 0, 60, measure));
+    TEST_ASSERT_EQUAL(firstMeasured, measured);
+
+    // any part of the key changes the layout
+    TEST_ASSERT_TRUE(layout.wrap(copy, OTHER_FONT, 0, 60, measure));
+    TEST_ASSERT_TRUE(layout.wrap(copy, OTHER_FONT, 0, 80, measure));
+    TEST_ASSERT_TRUE(layout.wrap(copy, OTHER_FONT, 2, 80, measure));
+    copy[0] = 'P';
+    TEST_ASSERT_TRUE(layout.wrap(copy, OTHER_FONT, 2, 80, measure));
+    TEST_ASSERT_EQUAL_STRING("Pour", layout.getRun(0).text);
+}
+
+void test_split_lines(void)
+{
+    TextLayout layout;
+    TEST_ASSERT_TRUE(layout.split("Add weight.\n\nClick to continue!", '\n'));
+    TEST_ASSERT_EQUAL(2, layout.getRunCount());
+    TEST_ASSERT_EQUAL_STRING("Add weight.", layout.getRun(0).text);
+    TEST_ASSERT_EQUAL(0, layout.getRun(0).line);
+    TEST_ASSERT_EQUAL_STRING("Click to continue!", layout.getRun(1).text);
+    TEST_ASSERT_EQUAL(1, layout.getRun(1).line);
+
+    TEST_ASSERT_FALSE(layout.split("Add weight.\n\nClick to continue!", '\n'));
+    // a wrap of the same text is a different layout
+    TEST_ASSERT_TRUE(layout.wrap("Add weight.\n\nClick to continue!", FONT, 0, 60, measure));
+}
+
+void test_long_text_is_cut_and_not_cached(void)
+{
+    static char text[TEXT_LAYOUT_TEXT_SIZE + 10];
+    memset(text, 'a', sizeof(text) - 1);
+    text[sizeof(text) - 1] = '\0';
+
+    TextLayout layout;
+    TEST_ASSERT_TRUE(layout.split(text, '\n'));
+    TEST_ASSERT_EQUAL(1, layout.getRunCount());
+    TEST_ASSERT_EQUAL(TEXT_LAYOUT_TEXT_SIZE - 1, strlen(layout.getRun(0).text));
+    TEST_ASSERT_TRUE(layout.split(text, '\n'));
+}
+
+void test_width_cache(void)
+{
+    TextWidthCache widths;
+    TEST_ASSERT_EQUAL(30, widths.width("Title", FONT, measure));
+    TEST_ASSERT_EQUAL(30, widths.width("Title", FONT, measure));
+    TEST_ASSERT_EQUAL(1, measured);
+
+    TEST_ASSERT_EQUAL(30, widths.width("Title", OTHER_FONT, measure));
+    TEST_ASSERT_EQUAL(12, widths.width("ab", FONT, measure));
+    TEST_ASSERT_EQUAL(3, measured);
+}
+
+void test_width_cache_compares_text(void)
+{
+    TextWidthCache widths;
+    // both have the same FNV-1a hash
+    TEST_ASSERT_EQUAL(60, widths.width("costarring", FONT, measure));
+    TEST_ASSERT_EQUAL(36, widths.width("liquid", FONT, measure));
+    TEST_ASSERT_EQUAL(2, measured);
+
+    // the null font of a fresh u8g2 object does not hit an unused entry
+    TEST_ASSERT_EQUAL(0, widths.width("", nullptr, measure));
+    TEST_ASSERT_EQUAL(3, measured);
+}
+
+void test_width_cache_measures_long_texts(void)
+{
+    static char text[TEXT_WIDTH_CACHE_TEXT_SIZE + 1];
+    memset(text, 'a', sizeof(text) - 1);
+    text[sizeof(text) - 1] = '\0';
+
+    TextWidthCache widths;
+    TEST_ASSERT_EQUAL(6 * TEXT_WIDTH_CACHE_TEXT_SIZE, widths.width(text, FONT, measure));
+    TEST_ASSERT_EQUAL(6 * TEXT_WIDTH_CACHE_TEXT_SIZE, widths.width(text, FONT, measure));
+    TEST_ASSERT_EQUAL(2, measured);
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_wrap_words);
+    RUN_TEST(test_wrap_starts_at_left);
+    RUN_TEST(test_repeated_delimiters_are_skipped);
+    RUN_TEST(test_layout_is_cached);
+    RUN_TEST(test_split_lines);
+    RUN_TEST(test_long_text_is_cut_and_not_cached);
+    RUN_TEST(test_width_cache);
+    RUN_TEST(test_width_cache_compares_text);
+    RUN_TEST(test_width_cache_measures_long_texts);
+    return UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,127 @@
+#include <unity.h>
+#include <vector>
+
+#include "tile_diff.h"
+
+struct Area
+{
+    uint8_t tx;
+    uint8_t ty;
+    uint8_t tw;
+};
+
+static std::vector<Area> sent;
+static uint8_t buffer[8 * 16 * TILE_BYTES];
+
+static void send(uint8_t tx, uint8_t ty, uint8_t tw, const uint8_t *tiles)
+{
+    TEST_ASSERT_TRUE(tiles == buffer + (ty * 8 + tx) * TILE_BYTES);
+    sent.push_back({tx, ty, tw});
+}
+
+static void setPixel(uint8_t x, uint8_t y)
+{
+    // u8g2 layout: tile rows of 8 pixel high columns
+    buffer[(y / 8) * 8 * TILE_BYTES + x] |= 1 << (y % 8);
+}
+
+void setUp(void)
+{
+    sent.clear();
+    memset(buffer, 0, sizeof(buffer));
+}
+
+void tearDown(void) {}
+
+void test_first_frame_is_sent_completely(void)
+{
+    TileDiff<8, 16> tiles;
+    TEST_ASSERT_EQUAL(1024, tiles.update(buffer, send));
+    // one run per tile row
+    TEST_ASSERT_EQUAL(16, sent.size());
+    TEST_ASSERT_EQUAL(8, sent[0].tw);
+}
+
+void test_unchanged_frame_sends_nothing(void)
+{
+    TileDiff<8, 16> tiles;
+    tiles.update(buffer, send);
+    sent.clear();
+
+    TEST_ASSERT_EQUAL(0, tiles.update(buffer, send));
+    TEST_ASSERT_EQUAL(0, sent.size());
+}
+
+void test_only_changed_tiles_are_sent(void)
+{
+    TileDiff<8, 16> tiles;
+    tiles.update(buffer, send);
+    sent.clear();
+
+    setPixel(20, 30);
+    TEST_ASSERT_EQUAL(TILE_BYTES, tiles.update(buffer, send));
+    TEST_ASSERT_EQUAL(1, sent.size());
+    TEST_ASSERT_EQUAL(2, sent[0].tx);
+    TEST_ASSERT_EQUAL(3, sent[0].ty);
+    TEST_ASSERT_EQUAL(1, sent[0].tw);
+}
+
+void test_adjacent_tiles_are_merged(void)
+{
+    TileDiff<8, 16> tiles;
+    tiles.update(buffer, send);
+    sent.clear();
+
+    setPixel(8, 0);
+    setPixel(16, 0);
+    setPixel(40, 0);
+    TEST_ASSERT_EQUAL(3 * TILE_BYTES, tiles.update(buffer, send));
+    TEST_ASSERT_EQUAL(2, sent.size());
+    TEST_ASSERT_EQUAL(1, sent[0].tx);
+    TEST_ASSERT_EQUAL(2, sent[0].tw);
+    TEST_ASSERT_EQUAL(5, sent[1].tx);
+    TEST_ASSERT_EQUAL(1, sent[1].tw);
+}
+
+void test_changing_digits_send_a_fraction_of_the_frame(void)
+{
+    TileDiff<8, 16> tiles;
+    // static content: a frame around the display
+    for (uint8_t x = 0; x < 64; x++)
+    {
+        setPixel(x, 0);
+        setPixel(x, 127);
+    }
+    tiles.update(buffer, send);
+
+    // a 30 px high digit changes in a 16 px wide column
+    for (uint8_t y = 10; y < 40; y++)
+    {
+        setPixel(30, y);
+        setPixel(45, y);
+    }
+    uint16_t bytes = tiles.update(buffer, send);
+    TEST_ASSERT_LESS_OR_EQUAL(tiles.frameBytes() / 10, bytes);
+    TEST_ASSERT_EQUAL(bytes, tiles.getLastFrameBytes());
+    TEST_ASSERT_EQUAL(tiles.frameBytes() + bytes, tiles.getTotalBytes());
+}
+
+void test_invalidate_sends_all_tiles(void)
+{
+    TileDiff<8, 16> tiles;
+    tiles.update(buffer, send);
+    tiles.invalidate();
+    TEST_ASSERT_EQUAL(1024, tiles.update(buffer, send));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_first_frame_is_sent_completely);
+    RUN_TEST(test_unchanged_frame_sends_nothing);
+    RUN_TEST(test_only_changed_tiles_are_sent);
+    RUN_TEST(test_adjacent_tiles_are_merged);
+    RUN_TEST(test_changing_digits_send_a_fraction_of_the_frame);
+    RUN_TEST(test_invalidate_sends_all_tiles);
+    UNITY_END();
+}
\ No newline at end of file
@@ -0,0 +1,64 @@
+#include <unity.h>
+
+#include "view_state.h"
+
+void setUp(void) {}
+
+void tearDown(void) {}
+
+void test_equal_values_hash_equal(void)
+{
+    ViewState a = ViewState(1).addText("12.34g").add((uint8_t)3);
+    ViewState b = ViewState(1).addText("12.34g").add((uint8_t)3);
+    TEST_ASSERT_EQUAL_UINT32(a.getHash(), b.getHash());
+}
+
+void test_different_values_hash_different(void)
+{
+    uint32_t base = ViewState(1).addText("12.34g").getHash();
+    TEST_ASSERT_NOT_EQUAL(base, ViewState(1).addText("12.35g").getHash());
+    // the screen is part of the state
+    TEST_ASSERT_NOT_EQUAL(base, ViewState(2).addText("12.34g").getHash());
+}
+
+void test_text_boundaries_are_hashed(void)
+{
+    // moving text from one field to the next changes the frame
+    uint32_t a = ViewState(1).addText("ab").addText("c").getHash();
+    uint32_t b = ViewState(1).addText("a").addText("bc").getHash();
+    TEST_ASSERT_NOT_EQUAL(a, b);
+    // nullptr is an empty string
+    TEST_ASSERT_EQUAL_UINT32(ViewState(1).addText("").getHash(), ViewState(1).addText(nullptr).getHash());
+}
+
+void test_skips_unchanged_frames(void)
+{
+    FrameSkipper frames;
+    TEST_ASSERT_TRUE(frames.shouldPush(ViewState(1).addText("a")));
+    TEST_ASSERT_FALSE(frames.shouldPush(ViewState(1).addText("a")));
+    TEST_ASSERT_FALSE(frames.shouldPush(ViewState(1).addText("a")));
+    TEST_ASSERT_TRUE(frames.shouldPush(ViewState(1).addText("b")));
+
+    TEST_ASSERT_EQUAL_UINT32(2, frames.getFramesPushed());
+    TEST_ASSERT_EQUAL_UINT32(2, frames.getFramesSkipped());
+}
+
+void test_invalidate_forces_push(void)
+{
+    FrameSkipper frames;
+    TEST_ASSERT_TRUE(frames.shouldPush(ViewState(1)));
+    frames.invalidate();
+    TEST_ASSERT_TRUE(frames.shouldPush(ViewState(1)));
+    TEST_ASSERT_FALSE(frames.shouldPush(ViewState(1)));
+}
+
+int main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_equal_values_hash_equal);
+    RUN_TEST(test_different_values_hash_different);
+    RUN_TEST(test_text_boundaries_are_hashed);
+    RUN_TEST(test_skips_unchanged_frames);
+    RUN_TEST(test_invalidate_forces_push);
+    UNITY_END();
+}
\ No newline at end of file